@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,14 @@
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
+#include <atomic>
+
 namespace L0 {
 
+namespace {
+std::atomic<uint64_t> nextStateGeneration{1u};
+} // namespace
+
 CommandList::~CommandList() {
     if (cmdQImmediate) {
         cmdQImmediate->destroy();
@@ -198,9 +204,14 @@ void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocati
     allocErase = std::find(container->begin(), container->end(), allocation);
     if (allocErase != container->end()) {
         container->erase(allocErase);
+        updateStateGeneration();
     }
 }
 
+void CommandList::updateStateGeneration() {
+    this->stateGeneration = nextStateGeneration.fetch_add(1u);
+}
+
 void CommandList::migrateSharedAllocations() {
     auto deviceImp = static_cast<DeviceImp *>(device);
     DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(deviceImp->getDriverHandle());
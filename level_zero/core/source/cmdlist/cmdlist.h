@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -402,7 +402,12 @@ struct CommandList : _ze_command_list_handle_t {
         return localDispatchSupport;
     }
 
+    uint64_t getStateGeneration() const {
+        return stateGeneration;
+    }
+
   protected:
+    void updateStateGeneration();
     NEO::GraphicsAllocation *getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize, bool copyOffload);
     NEO::GraphicsAllocation *getHostPtrAlloc(const void *buffer, uint64_t bufferSize, bool hostCopyAllowed, bool copyOffload);
     bool setupTimestampEventForMultiTile(Event *signalEvent);
@@ -434,6 +439,7 @@ struct CommandList : _ze_command_list_handle_t {
     int64_t currentBindingTablePoolBaseAddress = NEO::StreamProperty64::initValue;
 
     uint64_t currentScratchPatchAddress = 0;
+    uint64_t stateGeneration = 0;
 
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,8 +12,11 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -179,6 +182,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t destroy() override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, bool requireTaskCountUpdate);
     ze_result_t executeCommandListImmediateWithFlushTaskImpl(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool requireTaskCountUpdate, CommandQueue *cmdQ);
     ze_result_t appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
@@ -197,6 +202,12 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate);
+    ze_result_t flushDeferredAppends();
+    void flushDeferredAppendsOnHostWait();
+    std::unique_lock<std::recursive_mutex> lockDeferredFlushWindow();
+    bool isFlushDeferralAllowed(bool hasRelaxedOrderingDependencies, bool kernelOperation, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate) const;
+    bool isKernelMatchingDeferredFlushWindow(Kernel &kernel, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams);
+    std::array<NEO::GraphicsAllocation *, 3> getDeferredFlushWindowHeaps();
 
     bool preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     bool isSuitableUSMHostAlloc(NEO::SvmAllocationData *alloc);
@@ -220,6 +231,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool hasStallingCmdsForRelaxedOrdering(uint32_t numWaitEvents, bool relaxedOrderingDispatch) const;
     void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) override;
     void allocateOrReuseKernelPrivateMemoryIfNeeded(Kernel *kernel, uint32_t sizePerHwThread) override;
+    ze_result_t appendLaunchKernelWithParams(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, Event *event, CmdListKernelLaunchParams &launchParams) override;
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
 
     MOCKABLE_VIRTUAL void checkAssert();
@@ -227,6 +239,28 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     std::atomic<bool> dependenciesPresent{false};
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsCopyOffload = false;
+
+    // Appends already encoded in command stream but not yet submitted, see ImmediateCmdListDeferredFlushMaxAppends
+    struct DeferredFlushWindow {
+        std::chrono::steady_clock::time_point openTime{};
+        std::chrono::microseconds timeBudget{100};
+        uint32_t maxAppends = 0u;
+        uint32_t numDeferredAppends = 0u;
+        uint32_t numDeferredKernels = 0u;
+        ze_result_t flushResult = ZE_RESULT_SUCCESS;
+        bool performMigration = false;
+        bool hasStallingCmds = false;
+
+        // host waits of any thread may flush window, but only between appends, when command stream ends at streamEnd
+        std::recursive_mutex mutex;
+        size_t streamEnd = 0u;
+        bool flushableOnHostWait = false;
+
+        // state deferred kernels were encoded with, next kernel joins the window only when it matches
+        NEO::StreamProperties kernelStreamState{};
+        std::array<NEO::GraphicsAllocation *, 3> kernelHeaps{};
+        uint32_t kernelPerThreadScratchSize[2] = {};
+    } deferredFlushWindow;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
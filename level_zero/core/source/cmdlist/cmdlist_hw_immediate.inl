@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -26,13 +27,14 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/cpu_copy.h"
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_hw.h"
 #include "level_zero/core/source/device/bcs_split.h"
 #include "level_zero/core/source/device/device_imp.h"
-#include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/helpers/error_code_helper_l0.h"
 #include "level_zero/core/source/image/image.h"
@@ -48,12 +50,40 @@ namespace L0 {
 template <GFXCORE_FAMILY gfxCoreFamily>
 CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock) : BaseClass(numIddsPerBlock) {
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
+
+    if (NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.get() != -1) {
+        deferredFlushWindow.maxAppends = static_cast<uint32_t>(NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.get());
+    }
+    if (NEO::debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.get() != -1) {
+        deferredFlushWindow.timeBudget = std::chrono::microseconds(NEO::debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.get());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    flushDeferredAppends();
+    return BaseClass::destroy();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize) {
     this->commandContainer.fillReusableAllocationLists();
 
+    size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
+
+    // commands are encoded without holding window lock, host waits can't flush window until this append is flushed
+    auto &window = this->deferredFlushWindow;
+    {
+        auto windowLock = lockDeferredFlushWindow();
+        window.flushableOnHostWait = false;
+    }
+
+    // deferred appends can't outlive command buffer switch nor be dispatched with relaxed ordering, error is reported by next flush
+    if ((window.numDeferredAppends > 0u) &&
+        (hasRelaxedOrderingDependencies || (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize))) {
+        window.flushResult = flushDeferredAppends();
+    }
+
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
     if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
@@ -62,7 +92,6 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
         }
     }
 
-    size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize) {
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
@@ -540,6 +569,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     return flushImmediate(ret, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, true, false, hSignalEvent, false);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelWithParams(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, Event *event, CmdListKernelLaunchParams &launchParams) {
+    // deferred kernels are submitted with the state they were encoded with before kernel requiring other state is encoded, error is reported by next flush
+    auto &window = this->deferredFlushWindow;
+    if ((window.numDeferredKernels > 0u) && !isKernelMatchingDeferredFlushWindow(*kernel, threadGroupDimensions, launchParams)) {
+        window.flushResult = flushDeferredAppends();
+    }
+
+    return BaseClass::appendLaunchKernelWithParams(kernel, threadGroupDimensions, event, launchParams);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result) {
     bool nonWalkerSignalingHasRelaxedOrdering = false;
@@ -960,7 +1000,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(v
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
-    ze_result_t status = ZE_RESULT_SUCCESS;
+    ze_result_t status = flushDeferredAppends();
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
+    static_cast<DriverHandleImp *>(this->device->getDriverHandle())->flushDeferredSubmissions();
 
     auto waitQueue = this->cmdQImmediate;
 
@@ -1073,7 +1117,46 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
             if (signalEvent && (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
                 signalEvent->setLatestUsedCmdQueue(queue);
             }
-            inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, kernelOperation, copyOffloadSubmission, requireTaskCountUpdate);
+            auto &window = this->deferredFlushWindow;
+            auto windowLock = lockDeferredFlushWindow();
+            window.flushableOnHostWait = false;
+            if (window.flushResult != ZE_RESULT_SUCCESS) {
+                inputRet = window.flushResult;
+                window.flushResult = ZE_RESULT_SUCCESS;
+            } else if (isFlushDeferralAllowed(hasRelaxedOrderingDependencies, kernelOperation, hSignalEvent, requireTaskCountUpdate)) {
+                auto now = std::chrono::steady_clock::now();
+                if (window.numDeferredAppends == 0u) {
+                    window.openTime = now;
+                    static_cast<DriverHandleImp *>(this->device->getDriverHandle())->registerDeferredSubmission(this, [this]() { this->flushDeferredAppendsOnHostWait(); });
+                }
+                if (kernelOperation && (window.numDeferredKernels++ == 0u)) {
+                    window.kernelStreamState = this->requiredStreamState;
+                    window.kernelHeaps = getDeferredFlushWindowHeaps();
+                    window.kernelPerThreadScratchSize[0] = this->getCommandListPerThreadScratchSize(0u);
+                    window.kernelPerThreadScratchSize[1] = this->getCommandListPerThreadScratchSize(1u);
+                }
+                window.numDeferredAppends++;
+                window.performMigration |= performMigration;
+                window.hasStallingCmds |= hasStallingCmds;
+                if ((window.numDeferredAppends >= window.maxAppends) || (now - window.openTime >= window.timeBudget)) {
+                    inputRet = flushDeferredAppends();
+                } else {
+                    window.streamEnd = this->commandContainer.getCommandStream()->getUsed();
+                    window.flushableOnHostWait = true;
+                }
+            } else {
+                if (window.numDeferredAppends > 0u) {
+                    static_cast<DriverHandleImp *>(this->device->getDriverHandle())->unregisterDeferredSubmission(this);
+                }
+                performMigration |= window.performMigration;
+                hasStallingCmds |= window.hasStallingCmds;
+                kernelOperation |= (window.numDeferredKernels > 0u);
+                window.numDeferredAppends = 0u;
+                window.numDeferredKernels = 0u;
+                window.performMigration = false;
+                window.hasStallingCmds = false;
+                inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, kernelOperation, copyOffloadSubmission, requireTaskCountUpdate);
+            }
         } else {
             inputRet = executeCommandListImmediate(performMigration);
         }
@@ -1089,6 +1172,128 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushDeferralAllowed(bool hasRelaxedOrderingDependencies, bool kernelOperation, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate) const {
+    if ((this->deferredFlushWindow.maxAppends <= 1u) || this->isSyncModeQueue || isCopyOffloadEnabled()) {
+        return false;
+    }
+
+    // csr heaps shared with other command lists may be switched before deferred kernels are submitted
+    if (kernelOperation && !isCopyOnly(false) && this->immediateCmdListHeapSharing && (this->cmdListHeapAddressModel != NEO::HeapAddressModel::globalStateless)) {
+        return false;
+    }
+
+    return (hSignalEvent == nullptr) && !hasRelaxedOrderingDependencies && !requireTaskCountUpdate;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredAppends() {
+    auto &window = this->deferredFlushWindow;
+    auto windowLock = lockDeferredFlushWindow();
+    if (window.numDeferredAppends == 0u) {
+        // error of flush done on host wait
+        auto flushResult = window.flushResult;
+        window.flushResult = ZE_RESULT_SUCCESS;
+        return flushResult;
+    }
+
+    static_cast<DriverHandleImp *>(this->device->getDriverHandle())->unregisterDeferredSubmission(this);
+    window.flushableOnHostWait = false;
+    bool performMigration = window.performMigration;
+    bool hasStallingCmds = window.hasStallingCmds;
+    bool kernelOperation = (window.numDeferredKernels > 0u);
+    window.numDeferredAppends = 0u;
+    window.numDeferredKernels = 0u;
+    window.performMigration = false;
+    window.hasStallingCmds = false;
+
+    return executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, false, kernelOperation, false, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredAppendsOnHostWait() {
+    auto &window = this->deferredFlushWindow;
+    // window in use by append or flush in progress is submitted by its owner
+    std::unique_lock<std::recursive_mutex> windowLock(window.mutex, std::try_to_lock);
+    if (windowLock.owns_lock() && window.flushableOnHostWait && (this->commandContainer.getCommandStream()->getUsed() == window.streamEnd)) {
+        // error is reported by next flush
+        window.flushResult = flushDeferredAppends();
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+std::unique_lock<std::recursive_mutex> CommandListCoreFamilyImmediate<gfxCoreFamily>::lockDeferredFlushWindow() {
+    if (this->deferredFlushWindow.maxAppends <= 1u) {
+        return {};
+    }
+    return std::unique_lock<std::recursive_mutex>(this->deferredFlushWindow.mutex);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+std::array<NEO::GraphicsAllocation *, 3> CommandListCoreFamilyImmediate<gfxCoreFamily>::getDeferredFlushWindowHeaps() {
+    std::array<NEO::GraphicsAllocation *, 3> heaps{};
+    const NEO::HeapType heapTypes[] = {NEO::HeapType::surfaceState, NEO::HeapType::dynamicState, NEO::HeapType::indirectObject};
+    for (size_t i = 0u; i < heaps.size(); i++) {
+        auto heap = this->commandContainer.getIndirectHeap(heapTypes[i]);
+        heaps[i] = heap ? heap->getGraphicsAllocation() : nullptr;
+    }
+    return heaps;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isKernelMatchingDeferredFlushWindow(Kernel &kernel, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams) {
+    const auto &window = this->deferredFlushWindow;
+    const auto &kernelDescriptor = kernel.getKernelDescriptor();
+
+    for (uint32_t slotId = 0u; slotId < 2; slotId++) {
+        auto perThreadScratchSize = std::max(kernelDescriptor.kernelAttributes.perThreadScratchSize[slotId], launchParams.externalPerThreadScratchSize[slotId]);
+        if (perThreadScratchSize > window.kernelPerThreadScratchSize[slotId]) {
+            return false;
+        }
+    }
+
+    // deferred kernels are encoded against current heaps, so kernel must fit without switching to a new heap
+    if ((kernel.getImplicitArgs() != nullptr) || (getDeferredFlushWindowHeaps() != window.kernelHeaps)) {
+        return false;
+    }
+    auto hasHeapSpace = [this](NEO::HeapType heapType, size_t size) {
+        auto heap = this->commandContainer.getIndirectHeap(heapType);
+        return (heap == nullptr) || (heap->getAvailableSpace() >= size);
+    };
+    if (this->cmdListHeapAddressModel == NEO::HeapAddressModel::privateHeaps) {
+        auto requiredSshSize = NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredSsh(*kernel.getImmutableData()->getKernelInfo()) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultSshAlignment();
+        if (!hasHeapSpace(NEO::HeapType::surfaceState, requiredSshSize)) {
+            return false;
+        }
+        auto requiredDshSize = NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredDsh(kernelDescriptor, 1u) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultDshAlignment();
+        if (this->dynamicHeapRequired && !hasHeapSpace(NEO::HeapType::dynamicState, requiredDshSize)) {
+            return false;
+        }
+    }
+    size_t requiredIohSize = kernel.getCrossThreadDataSize() + kernel.getPerThreadDataSizeForWholeThreadGroup() + launchParams.reserveExtraPayloadSpace +
+                             GfxFamily::indirectDataAlignment + GfxFamily::cacheLineSize;
+    if (!hasHeapSpace(NEO::HeapType::indirectObject, requiredIohSize)) {
+        return false;
+    }
+
+    if (this->heaplessStateInitEnabled || launchParams.makeKernelCommandView) {
+        return true;
+    }
+
+    // copy keeps properties support of command list, only kernel properties are set on it
+    NEO::StreamProperties kernelStreamState = this->requiredStreamState;
+    this->setKernelStreamPropertiesForFlushTask(kernelStreamState, kernel, launchParams.isCooperative, threadGroupDimensions, launchParams.isIndirect);
+    const auto &windowStreamState = window.kernelStreamState;
+    bool streamStateMatching = (kernelStreamState.stateComputeMode.largeGrfMode.value == windowStreamState.stateComputeMode.largeGrfMode.value) &&
+                               (kernelStreamState.stateComputeMode.threadArbitrationPolicy.value == windowStreamState.stateComputeMode.threadArbitrationPolicy.value) &&
+                               (kernelStreamState.frontEndState.computeDispatchAllWalkerEnable.value == windowStreamState.frontEndState.computeDispatchAllWalkerEnable.value) &&
+                               (kernelStreamState.frontEndState.disableEUFusion.value == windowStreamState.frontEndState.disableEUFusion.value) &&
+                               (kernelStreamState.frontEndState.disableOverdispatch.value == windowStreamState.frontEndState.disableOverdispatch.value) &&
+                               (kernelStreamState.pipelineSelect.systolicMode.value == windowStreamState.pipelineSelect.systolicMode.value) &&
+                               (kernelStreamState.stateBaseAddress.statelessMocs.value == windowStreamState.stateBaseAddress.statelessMocs.value);
+    return streamStateMatching;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (NEO::debugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
@@ -1166,6 +1371,11 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSuitableUSMSharedAlloc(NEO
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto ret = flushDeferredAppends();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
     bool lockingFailed = false;
     auto srcLockPointer = obtainLockedPtrFromDevice(cpuMemCopyInfo.srcAllocData, const_cast<void *>(cpuMemCopyInfo.srcPtr), lockingFailed);
     if (lockingFailed) {
@@ -1230,7 +1440,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    // locked device memory is mapped write-combined, streaming stores avoid partial WC buffer evictions
+    const bool nonTemporalCopy = dstLockPointer != nullptr && NEO::debugManager.flags.EnableNonTemporalCpuCopy.get() == 1;
+    size_t chunkSize = NEO::CpuCopy::defaultChunkSize;
+    if (NEO::debugManager.flags.ExperimentalCpuCopyChunkSize.get() != -1) {
+        chunkSize = static_cast<size_t>(NEO::debugManager.flags.ExperimentalCpuCopyChunkSize.get());
+    }
+    NEO::ParallelTaskPool *cpuCopyTaskPool = nullptr;
+    if (NEO::debugManager.flags.CpuCopyWorkerThreads.get() > 0 && cpuMemCopyInfo.size > chunkSize) {
+        cpuCopyTaskPool = this->device->getNEODevice()->getExecutionEnvironment()->initializeCpuCopyTaskPool();
+    }
+    NEO::CpuCopy::copy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size, nonTemporalCopy, cpuCopyTaskPool, chunkSize);
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
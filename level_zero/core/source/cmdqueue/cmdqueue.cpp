@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -33,6 +34,8 @@
 
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -151,6 +154,9 @@ NEO::SubmissionStatus CommandQueueImp::submitBatchBuffer(size_t offset, NEO::Res
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
+    // queue work may wait for appends deferred by immediate command lists
+    static_cast<DriverHandleImp *>(device->getDriverHandle())->flushDeferredSubmissions();
+
     if ((timeout == std::numeric_limits<uint64_t>::max()) && useKmdWaitFunction) {
         auto &waitPair = buffers.getCurrentFlushStamp();
         const auto waitStatus = csr->waitForTaskCountWithKmdNotifyFallback(waitPair.first, waitPair.second, false, NEO::QueueThrottle::MEDIUM);
@@ -352,6 +358,62 @@ void CommandQueueImp::makeResidentAndMigrate(bool performMigration, const NEO::R
     }
 }
 
+bool CommandQueueImp::CommandListsExecutionPlan::matches(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists) const {
+    if (entries.empty() || entries.size() != numCommandLists) {
+        return false;
+    }
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        auto &entry = entries[i];
+        if (entry.commandList != commandList ||
+            entry.stateGeneration != commandList->getStateGeneration() ||
+            entry.residencySize != commandList->getCmdContainer().getResidencyContainer().size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CommandQueueImp::CommandListsExecutionPlan::record(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists) {
+    entries.clear();
+    residencyContainer.clear();
+    built = false;
+
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        if (commandList->isImmediateType() || commandList->getStateGeneration() == 0) {
+            entries.clear();
+            return;
+        }
+        entries.push_back({commandList, commandList->getStateGeneration(), commandList->getCmdContainer().getResidencyContainer().size()});
+    }
+}
+
+void CommandQueueImp::CommandListsExecutionPlan::build(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists) {
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto &commandListResidency = CommandList::fromHandle(phCommandLists[i])->getCmdContainer().getResidencyContainer();
+        residencyContainer.insert(residencyContainer.end(), commandListResidency.begin(), commandListResidency.end());
+    }
+    std::sort(residencyContainer.begin(), residencyContainer.end());
+    residencyContainer.erase(std::unique(residencyContainer.begin(), residencyContainer.end()), residencyContainer.end());
+    built = true;
+}
+
+const NEO::ResidencyContainer *CommandQueueImp::getExecutionPlanResidency(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists) {
+    if (NEO::debugManager.flags.EnableCommandListsExecutionPlan.get() == 0) {
+        return nullptr;
+    }
+    if (!executionPlan.matches(phCommandLists, numCommandLists)) {
+        executionPlan.record(phCommandLists, numCommandLists);
+        return nullptr;
+    }
+    // built on first repeated submission, batches executed only once do not pay for merging
+    if (!executionPlan.built) {
+        executionPlan.build(phCommandLists, numCommandLists);
+    }
+    return &executionPlan.residencyContainer;
+}
+
 ze_result_t CommandQueueImp::getOrdinal(uint32_t *pOrdinal) {
     *pOrdinal = desc.ordinal;
     return ZE_RESULT_SUCCESS;
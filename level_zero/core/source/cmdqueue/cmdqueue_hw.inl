@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -228,6 +228,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegularHeapless(
 
     if (!parentImmediateCommandlistLinearStream) {
         this->csr->getResidencyAllocations().clear();
+        this->csr->getGenerationResidentAllocations().clear();
     }
     return retVal;
 }
@@ -455,6 +456,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
 
     if (!parentImmediateCommandlistLinearStream) {
         this->csr->getResidencyAllocations().clear();
+        this->csr->getGenerationResidentAllocations().clear();
     }
 
     this->stateChanges.clear();
@@ -543,6 +545,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsCopyOnly(
 
     if (!parentImmediateCommandlistLinearStream) {
         this->csr->getResidencyAllocations().clear();
+        this->csr->getGenerationResidentAllocations().clear();
     }
 
     return retVal;
@@ -783,6 +786,7 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
     NEO::LinearStream *parentImmediateCommandlistLinearStream) {
 
     ctx.containsAnyRegularCmdList = !ctx.firstCommandList->isImmediateType();
+    auto executionPlanResidency = this->getExecutionPlanResidency(phCommandLists, numCommandLists);
 
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = static_cast<CommandListImp *>(CommandList::fromHandle(phCommandLists[i]));
@@ -835,7 +839,13 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
             commandList->registerCsrDcFlushForDcMitigation(*this->getCsr());
         }
 
-        makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+        if (executionPlanResidency == nullptr) {
+            makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+        }
+    }
+
+    if (executionPlanResidency != nullptr) {
+        makeResidentAndMigrate(ctx.isMigrationRequested, *executionPlanResidency);
     }
 
     if (parentImmediateCommandlistLinearStream) {
@@ -1491,11 +1501,13 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::handleSubmissionAndCompletionResults(
     ze_result_t completionRet) {
 
     if ((submitRet != NEO::SubmissionStatus::success) || (completionRet == ZE_RESULT_ERROR_DEVICE_LOST)) {
-        for (auto &gfx : this->csr->getResidencyAllocations()) {
-            if (this->csr->peekLatestFlushedTaskCount() == 0) {
-                gfx->releaseUsageInOsContext(this->csr->getOsContext().getContextId());
-            } else {
-                gfx->updateTaskCount(this->csr->peekLatestFlushedTaskCount(), this->csr->getOsContext().getContextId());
+        for (auto residencyContainer : {&this->csr->getResidencyAllocations(), &this->csr->getGenerationResidentAllocations()}) {
+            for (auto &gfx : *residencyContainer) {
+                if (this->csr->peekLatestFlushedTaskCount() == 0) {
+                    gfx->releaseUsageInOsContext(this->csr->getOsContext().getContextId());
+                } else {
+                    gfx->updateTaskCount(this->csr->peekLatestFlushedTaskCount(), this->csr->getOsContext().getContextId());
+                }
             }
         }
         if (completionRet != ZE_RESULT_ERROR_DEVICE_LOST) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -151,7 +151,27 @@ struct CommandQueueImp : public CommandQueue {
 
     using CommandListStateChangeList = StackVec<CommandListRequiredStateChange, CommandQueueImp::defaultCommandListStateChangeListSize>;
 
+    // Residency merged across command lists of last executed batch.
+    // Valid as long as the same command lists are executed in the same order and none of them was closed, reset or had its residency changed.
+    struct CommandListsExecutionPlan {
+        struct Entry {
+            CommandList *commandList = nullptr;
+            uint64_t stateGeneration = 0;
+            size_t residencySize = 0;
+        };
+
+        bool matches(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists) const;
+        void record(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists);
+        void build(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists);
+
+        std::vector<Entry> entries;
+        NEO::ResidencyContainer residencyContainer;
+        bool built = false;
+    };
+    const NEO::ResidencyContainer *getExecutionPlanResidency(ze_command_list_handle_t *phCommandLists, uint32_t numCommandLists);
+
     CommandListStateChangeList stateChanges;
+    CommandListsExecutionPlan executionPlan;
     CommandBufferManager buffers;
     NEO::LinearStream commandStream{};
     NEO::LinearStream firstCmdListStream{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@
 
 #include "driver_version.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
@@ -189,6 +190,7 @@ DriverHandleImp::~DriverHandleImp() {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
             this->usmHostMemAllocPool.cleanup();
         }
+        this->eventPoolAllocationsCache.cleanup(*memoryManager);
     }
 
     for (auto &device : this->devices) {
@@ -1060,6 +1062,37 @@ uint32_t DriverHandleImp::getEventMaxKernelCount(uint32_t numDevices, ze_device_
     return maxCount;
 }
 
+void DriverHandleImp::registerDeferredSubmission(const void *owner, std::function<void()> flushFunction) {
+    std::lock_guard<std::recursive_mutex> lock(deferredSubmissionsMutex);
+    auto element = std::find_if(deferredSubmissions.begin(), deferredSubmissions.end(), [owner](const auto &submission) { return submission.first == owner; });
+    if (element == deferredSubmissions.end()) {
+        deferredSubmissions.emplace_back(owner, std::move(flushFunction));
+        numDeferredSubmissions++;
+    }
+}
+
+void DriverHandleImp::unregisterDeferredSubmission(const void *owner) {
+    std::lock_guard<std::recursive_mutex> lock(deferredSubmissionsMutex);
+    auto element = std::find_if(deferredSubmissions.begin(), deferredSubmissions.end(), [owner](const auto &submission) { return submission.first == owner; });
+    if (element != deferredSubmissions.end()) {
+        deferredSubmissions.erase(element);
+        numDeferredSubmissions--;
+    }
+}
+
+void DriverHandleImp::flushDeferredSubmissions() {
+    if (numDeferredSubmissions.load() == 0u) {
+        return;
+    }
+
+    // owners unregister when flushed, lock is held so none of them is destroyed before its flush function returns
+    std::lock_guard<std::recursive_mutex> lock(deferredSubmissionsMutex);
+    auto submissions = deferredSubmissions;
+    for (auto &submission : submissions) {
+        submission.second();
+    }
+}
+
 int DriverHandleImp::setErrorDescription(const std::string &str) {
     return this->devices[0]->getNEODevice()->getExecutionEnvironment()->setErrorDescription(str);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,8 +14,11 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event_pool_allocations_cache.h"
 #include "level_zero/include/ze_intel_gpu.h"
 
+#include <atomic>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <unordered_map>
@@ -128,6 +131,11 @@ struct DriverHandleImp : public DriverHandle {
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
     void initHostUsmAllocPool();
 
+    // immediate command lists with appends encoded but not submitted yet, see ImmediateCmdListDeferredFlushMaxAppends
+    void registerDeferredSubmission(const void *owner, std::function<void()> flushFunction);
+    void unregisterDeferredSubmission(const void *owner);
+    void flushDeferredSubmissions();
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
 
     std::mutex sharedMakeResidentAllocationsLock;
@@ -140,6 +148,10 @@ struct DriverHandleImp : public DriverHandle {
 
     std::mutex rtasLock;
 
+    std::vector<std::pair<const void *, std::function<void()>>> deferredSubmissions;
+    std::recursive_mutex deferredSubmissionsMutex;
+    std::atomic<uint32_t> numDeferredSubmissions{0u};
+
     // Spec extensions
     static const std::vector<std::pair<std::string, uint32_t>> extensionsSupported;
 
@@ -149,6 +161,7 @@ struct DriverHandleImp : public DriverHandle {
     NEO::MemoryManager *memoryManager = nullptr;
     NEO::SVMAllocsManager *svmAllocsManager = nullptr;
     NEO::UsmMemAllocPool usmHostMemAllocPool;
+    EventPoolAllocationsCache eventPoolAllocationsCache;
 
     std::unique_ptr<NEO::OsLibrary> rtasLibraryHandle;
     bool rtasLibraryUnavailable = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -110,11 +110,30 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         allocationType = NEO::AllocationType::gpuTimestampDeviceBuffer;
     }
 
+    auto neoDevice = devices[0]->getNEODevice();
+
+    const bool allocationReusable = !isIpcPoolFlagSet();
+    if (allocationReusable) {
+        for (auto rootDeviceIndex : rootDeviceIndices) {
+            allocationsCacheKey.rootDeviceIndices.push_back(rootDeviceIndex);
+        }
+        allocationsCacheKey.deviceBitfield = neoDevice->getDeviceBitfield();
+        allocationsCacheKey.size = this->eventPoolSize;
+        allocationsCacheKey.allocationType = allocationType;
+        allocationsCacheKey.deviceAllocation = this->isDeviceEventPoolAllocation;
+        allocationsCacheKey.hostVisible = !this->isDeviceEventPoolAllocation || !isEventPoolDeviceAllocationFlagSet();
+
+        if (driverHandleImp->eventPoolAllocationsCache.obtain(allocationsCacheKey, eventPoolAllocations, eventPoolPtr)) {
+            this->isHostVisibleEventPoolAllocation = allocationsCacheKey.hostVisible;
+            this->isAllocationReusable = true;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
 
     bool allocatedMemory = false;
 
-    auto neoDevice = devices[0]->getNEODevice();
     if (this->isDeviceEventPoolAllocation) {
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
@@ -150,13 +169,19 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
     if (neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode()) {
         eventPoolAllocations->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
     }
+    this->isAllocationReusable = allocationReusable;
     return ZE_RESULT_SUCCESS;
 }
 
 EventPool::~EventPool() {
     if (eventPoolAllocations) {
+        auto driverHandleImp = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+        if (this->isAllocationReusable && driverHandleImp->eventPoolAllocationsCache.release(allocationsCacheKey, eventPoolAllocations, eventPoolPtr)) {
+            return;
+        }
+
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
-        auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
+        auto memoryManager = driverHandleImp->getMemoryManager();
         for (auto gpuAllocation : graphicsAllocations) {
             memoryManager->freeGraphicsMemory(gpuAllocation);
         }
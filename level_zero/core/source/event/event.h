@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/core/source/event/event_pool_allocations_cache.h"
 #include "level_zero/core/source/helpers/api_handle_helper.h"
 #include <level_zero/ze_api.h>
 
@@ -470,6 +471,7 @@ struct EventPool : _ze_event_pool_handle_t {
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
     void *eventPoolPtr = nullptr;
     ContextImp *context = nullptr;
+    EventPoolAllocationsCache::Key allocationsCacheKey;
 
     size_t numEvents = 1;
     size_t eventPoolSize = 0;
@@ -489,6 +491,7 @@ struct EventPool : _ze_event_pool_handle_t {
     bool isIpcPoolFlag = false;
     bool isShareableEventMemory = false;
     bool isImplicitScalingCapable = false;
+    bool isAllocationReusable = false;
 };
 
 } // namespace L0
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_allocations_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+namespace L0 {
+
+bool EventPoolAllocationsCache::Key::operator==(const Key &other) const {
+    return (size == other.size) &&
+           (allocationType == other.allocationType) &&
+           (deviceAllocation == other.deviceAllocation) &&
+           (hostVisible == other.hostVisible) &&
+           (deviceBitfield == other.deviceBitfield) &&
+           (rootDeviceIndices == other.rootDeviceIndices);
+}
+
+bool EventPoolAllocationsCache::obtain(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *&hostPtr) {
+    if (NEO::debugManager.flags.EventPoolAllocationsCacheSize.get() <= 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // most recently released entry first, its memory is most likely still cached
+    for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+        if (it->key == key) {
+            allocations = std::move(it->allocations);
+            hostPtr = it->hostPtr;
+            entries.erase(std::next(it).base());
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EventPoolAllocationsCache::release(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *hostPtr) {
+    const auto maxEntries = NEO::debugManager.flags.EventPoolAllocationsCacheSize.get();
+    if (maxEntries <= 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!active || (entries.size() >= static_cast<size_t>(maxEntries))) {
+        return false;
+    }
+
+    entries.push_back({key, std::move(allocations), hostPtr});
+    return true;
+}
+
+void EventPoolAllocationsCache::cleanup(NEO::MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mtx);
+    active = false;
+
+    for (auto &entry : entries) {
+        for (auto graphicsAllocation : entry.allocations->getGraphicsAllocations()) {
+            memoryManager.freeGraphicsMemory(graphicsAllocation);
+        }
+    }
+    entries.clear();
+}
+
+size_t EventPoolAllocationsCache::getNumCachedAllocations() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+} // namespace L0
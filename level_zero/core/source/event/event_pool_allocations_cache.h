@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/device_bitfield.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+
+// Allocations of destroyed event pools, kept for new pools with the same allocation requirements.
+// Events are reset when created, so reused memory needs no initialization.
+class EventPoolAllocationsCache {
+  public:
+    struct Key {
+        StackVec<uint32_t, maxRootDeviceIndices> rootDeviceIndices;
+        NEO::DeviceBitfield deviceBitfield{};
+        size_t size = 0u;
+        NEO::AllocationType allocationType = NEO::AllocationType::unknown;
+        bool deviceAllocation = false;
+        bool hostVisible = false;
+
+        bool operator==(const Key &other) const;
+    };
+
+    bool obtain(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *&hostPtr);
+    bool release(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *hostPtr);
+    void cleanup(NEO::MemoryManager &memoryManager);
+    size_t getNumCachedAllocations();
+
+  protected:
+    struct Entry {
+        Key key;
+        std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+        void *hostPtr = nullptr;
+    };
+
+    std::vector<Entry> entries;
+    std::mutex mtx;
+    bool active = true;
+};
+
+} // namespace L0
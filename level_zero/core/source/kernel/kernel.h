@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,8 @@ struct KernelImmutableData {
 
     const NEO::KernelDescriptor &getDescriptor() const { return *kernelDescriptor; }
 
+    bool isInitialized() const { return nullptr != kernelDescriptor; }
+
     Device *getDevice() { return this->device; }
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
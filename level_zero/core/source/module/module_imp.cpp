@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/device_binary_format/zebin/debug_zebin.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
@@ -41,6 +42,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -55,6 +57,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 namespace L0 {
 
@@ -374,6 +377,9 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::DecodeError decodeError;
     NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
     auto &gfxCoreHelper = device->getGfxCoreHelper();
+    programInfo.deferKernelsZeInfoDecoding = (NEO::debugManager.flags.DeferZeInfoKernelsDecoding.get() == 1) &&
+                                             (nullptr == device->getL0Debugger()) &&
+                                             (nullptr == this->debugData);
     std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
@@ -463,6 +469,38 @@ void ModuleTranslationUnit::updateBuildLog(const std::string &newLogEntry) {
     }
 }
 
+ze_result_t ModuleTranslationUnit::decodeDeferredKernelDescriptors(const std::vector<NEO::KernelInfo *> &kernelInfos) {
+    const auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto taskPool = device->getNEODevice()->getExecutionEnvironment()->initializeTaskPool();
+    auto decodeError = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(kernelInfos, decodeErrors, decodeWarnings, taskPool);
+    if (decodeWarnings.empty() == false) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
+    }
+
+    if (NEO::DecodeError::success != decodeError) {
+        CREATE_DEBUG_STRING(str, "%s\n", decodeErrors.c_str());
+        driverHandle->setErrorDescription(std::string(str.get()));
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeErrors.c_str());
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
+
+    // deferred kernels were skipped by SLM check of processUnpackedBinary
+    uint32_t slmNeeded = 0U;
+    for (const auto &kernelInfo : kernelInfos) {
+        slmNeeded = std::max(slmNeeded, kernelInfo->kernelDescriptor.kernelAttributes.slmInlineSize);
+    }
+    auto slmAvailable = static_cast<uint32_t>(device->getDeviceInfo().localMemSize);
+    if (slmNeeded > slmAvailable) {
+        CREATE_DEBUG_STRING(str, "Size of SLM (%u) larger than available (%u)\n", slmNeeded, slmAvailable);
+        driverHandle->setErrorDescription(std::string(str.get()));
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Size of SLM (%u) larger than available (%u)\n", slmNeeded, slmAvailable);
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 void ModuleTranslationUnit::processDebugData() {
     if (this->debugData != nullptr) {
         iOpenCL::SProgramDebugDataHeaderIGC *programDebugHeader = reinterpret_cast<iOpenCL::SProgramDebugDataHeaderIGC *>(debugData.get());
@@ -524,13 +562,17 @@ ModuleImp::~ModuleImp() {
 
 NEO::Zebin::Debug::Segments ModuleImp::getZebinSegments() {
     std::vector<NEO::Zebin::Debug::Segments::KernelNameIsaTupleT> kernels;
-    for (const auto &kernelImmData : kernelImmDatas) {
+    auto lock = this->lockDeferredKernels();
+    for (size_t kernelId = 0; kernelId < kernelImmDatas.size(); kernelId++) {
+        const auto &kernelImmData = kernelImmDatas[kernelId];
         NEO::Zebin::Debug::Segments::Segment segment = {kernelImmData->getIsaGraphicsAllocation()->getGpuAddress(), kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBufferSize()};
         if (kernelImmData->getIsaParentAllocation()) {
             segment.address += kernelImmData->getIsaOffsetInParentAllocation();
             segment.size = kernelImmData->getIsaSubAllocationSize();
         }
-        kernels.push_back({kernelImmData->getDescriptor().kernelMetadata.kernelName, segment});
+        const auto &kernelName = kernelImmData->isInitialized() ? kernelImmData->getDescriptor().kernelMetadata.kernelName
+                                                                : translationUnit->programInfo.kernelInfos[kernelId]->kernelDescriptor.kernelMetadata.kernelName;
+        kernels.push_back({kernelName, segment});
     }
 
     ArrayRef<const uint8_t> strings = {reinterpret_cast<const uint8_t *>(translationUnit->programInfo.globalStrings.initData),
@@ -546,6 +588,9 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
         return result;
     }
 
+    if (result = this->decodeDeferredKernelDescriptorsIfRequired(neoDevice); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     if (this->shouldBuildBeFailed(neoDevice)) {
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
@@ -597,19 +642,48 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             return;
         }
 
+        // ISA shared with other modules is uploaded only by the first one
+        auto deduplicatedIsa = this->sharedIsaAllocation->getDeduplicatedIsa();
+        if (deduplicatedIsa && deduplicatedIsa->uploaded.load()) {
+            for (auto &kernelImmData : kernelImmDatas) {
+                kernelImmData->setIsaCopiedToAllocation();
+            }
+            return;
+        }
+
         const auto isaBufferSize = this->sharedIsaAllocation->getSize();
         DEBUG_BREAK_IF(isaBufferSize == 0);
-        auto isaBuffer = std::vector<std::byte>(isaBufferSize);
-        std::memset(isaBuffer.data(), 0x0, isaBufferSize);
         auto moduleOffset = sharedIsaAllocation->getOffset();
         for (auto &kernelImmData : this->kernelImmDatas) {
             DEBUG_BREAK_IF(kernelImmData->isIsaCopiedToAllocation());
             kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
             kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+        }
 
-            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            auto isaOffset = kernelImmData->getIsaOffsetInParentAllocation() - moduleOffset;
-            memcpy_s(isaBuffer.data() + isaOffset, isaBufferSize - isaOffset, kernelHeapPtr, kernelHeapSize);
+        std::vector<std::byte> isaBuffer;
+        const void *isaToTransfer = nullptr;
+        if (deduplicatedIsa) {
+            isaToTransfer = deduplicatedIsa->isaImage.data();
+        } else {
+            isaBuffer.resize(isaBufferSize);
+            std::memset(isaBuffer.data(), 0x0, isaBufferSize);
+
+            // kernels occupy disjoint ranges of isaBuffer
+            auto copyKernelIsa = [&](size_t kernelId) {
+                auto &kernelImmData = this->kernelImmDatas[kernelId];
+                auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+                auto isaOffset = kernelImmData->getIsaOffsetInParentAllocation() - moduleOffset;
+                memcpy_s(isaBuffer.data() + isaOffset, isaBufferSize - isaOffset, kernelHeapPtr, kernelHeapSize);
+            };
+            auto taskPool = neoDevice->getExecutionEnvironment()->initializeTaskPool();
+            if (taskPool) {
+                taskPool->run(this->kernelImmDatas.size(), copyKernelIsa);
+            } else {
+                for (size_t kernelId = 0; kernelId < this->kernelImmDatas.size(); kernelId++) {
+                    copyKernelIsa(kernelId);
+                }
+            }
+            isaToTransfer = isaBuffer.data();
         }
         auto moduleAllocation = this->sharedIsaAllocation->getGraphicsAllocation();
         auto lock = this->sharedIsaAllocation->obtainSharedAllocationLock();
@@ -617,13 +691,16 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
                                                               *neoDevice,
                                                               moduleAllocation,
                                                               moduleOffset,
-                                                              isaBuffer.data(),
-                                                              isaBuffer.size());
+                                                              isaToTransfer,
+                                                              isaBufferSize);
 
         if (neoDevice->getDefaultEngine().commandStreamReceiver->getType() != NEO::CommandStreamReceiverType::hardware) {
             neoDevice->getDefaultEngine().commandStreamReceiver->writeMemory(*moduleAllocation);
         }
 
+        if (deduplicatedIsa) {
+            deduplicatedIsa->uploaded.store(true);
+        }
         for (auto &kernelImmData : kernelImmDatas) {
             kernelImmData->setIsaCopiedToAllocation();
         }
@@ -649,13 +726,14 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
 
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
                                                                        const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
+    auto kernelId = &kernelImmData - &this->kernelImmDatas[0];
     if (isaSegmentsForPatching) {
         auto &segments = *isaSegmentsForPatching;
-        auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
-        return {segments[segmentId].hostPointer, segments[segmentId].segmentSize};
+        return {segments[kernelId].hostPointer, segments[kernelId].segmentSize};
     } else {
-        return {kernelImmData->getKernelInfo()->heapInfo.pKernelHeap,
-                static_cast<size_t>(kernelImmData->getKernelInfo()->heapInfo.kernelHeapSize)};
+        // immutable data of deferred kernel is not initialized yet, ISA is known from its kernel info
+        const auto &heapInfo = this->translationUnit->programInfo.kernelInfos[kernelId]->heapInfo;
+        return {heapInfo.pKernelHeap, static_cast<size_t>(heapInfo.kernelHeapSize)};
     }
 }
 
@@ -767,28 +845,104 @@ inline bool ModuleImp::shouldBuildBeFailed(NEO::Device *neoDevice) {
            isGeneratedByIgc;
 }
 
+ze_result_t ModuleImp::decodeDeferredKernelDescriptorsIfRequired(NEO::Device *neoDevice) {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    if (std::none_of(kernelInfos.begin(), kernelInfos.end(), [](const auto &kernelInfo) { return kernelInfo->isKernelDescriptorDeferred(); })) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // debugger registration, ISA relocations of implicit args, kernel dependencies and stateful access check need descriptors of all kernels
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    bool allDescriptorsRequired = (nullptr != this->device->getL0Debugger()) ||
+                                  ((nullptr != linkerInput) && (linkerInput->getTraits().requiresPatchingOfInstructionSegments || (false == linkerInput->getKernelDependencies().empty()))) ||
+                                  NEO::AddressingModeHelper::failBuildProgramWithStatefulAccess(neoDevice->getRootDeviceEnvironment());
+    if (false == allDescriptorsRequired) {
+        this->hasDeferredKernels = true;
+        return ZE_RESULT_SUCCESS;
+    }
+    return this->translationUnit->decodeDeferredKernelDescriptors(kernelInfos);
+}
+
 ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     if (size_t kernelsCount = this->translationUnit->programInfo.kernelInfos.size(); kernelsCount > 0lu) {
         ze_result_t result;
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+
+        // each kernel writes only its own immutable data and result slot
+        std::vector<ze_result_t> results(kernelsCount, ZE_RESULT_SUCCESS);
+        auto initializeKernelImmutableData = [&](size_t kernelId) {
+            auto kernelInfo = this->translationUnit->programInfo.kernelInfos[kernelId];
+            if (kernelInfo->isKernelDescriptorDeferred()) {
+                return;
+            }
+            results[kernelId] = kernelImmDatas[kernelId]->initialize(kernelInfo,
+                                                                     device,
+                                                                     device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                                     this->translationUnit->globalConstBuffer,
+                                                                     this->translationUnit->globalVarBuffer,
+                                                                     this->type == ModuleType::builtin);
+        };
+
+        // bindless slots of global buffers and debugger state are shared between kernels, such modules are initialized serially
+        auto neoDevice = device->getNEODevice();
+        auto taskPool = (neoDevice->getBindlessHeapsHelper() == nullptr && neoDevice->getDebugger() == nullptr)
+                            ? neoDevice->getExecutionEnvironment()->initializeTaskPool()
+                            : nullptr;
+        if (taskPool) {
+            taskPool->run(kernelsCount, initializeKernelImmutableData);
+        }
+
         for (size_t i = 0lu; i < kernelsCount; i++) {
-            result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
-                                                   device,
-                                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                                   this->translationUnit->globalConstBuffer,
-                                                   this->translationUnit->globalVarBuffer,
-                                                   this->type == ModuleType::builtin);
-            if (result != ZE_RESULT_SUCCESS) {
+            if (taskPool == nullptr) {
+                initializeKernelImmutableData(i);
+            }
+            if (results[i] != ZE_RESULT_SUCCESS) {
                 kernelImmDatas[i].reset();
-                return result;
+                return results[i];
             }
         }
     }
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeDeferredKernelImmutableData(const char *kernelName) {
+    auto lock = this->lockDeferredKernels();
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    for (size_t i = 0lu; i < kernelInfos.size(); i++) {
+        auto kernelInfo = kernelInfos[i];
+        if ((false == kernelInfo->isKernelDescriptorDeferred()) || (kernelInfo->kernelDescriptor.kernelMetadata.kernelName.compare(kernelName) != 0)) {
+            continue;
+        }
+
+        auto result = this->translationUnit->decodeDeferredKernelDescriptors({kernelInfo});
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        result = kernelImmDatas[i]->initialize(kernelInfo,
+                                               device,
+                                               device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                               this->translationUnit->globalConstBuffer,
+                                               this->translationUnit->globalVarBuffer,
+                                               this->type == ModuleType::builtin);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        this->checkIfPrivateMemoryPerDispatchIsNeeded();
+        return ZE_RESULT_SUCCESS;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+std::unique_lock<std::mutex> ModuleImp::lockDeferredKernels() const {
+    std::unique_lock<std::mutex> lock(this->deferredKernelsMutex, std::defer_lock);
+    if (this->hasDeferredKernels) {
+        lock.lock();
+    }
+    return lock;
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -820,7 +974,18 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
         auto neoDevice = this->device->getNEODevice();
         auto &isaAllocator = neoDevice->getIsaPoolAllocator();
-        auto crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
+        NEO::SharedIsaAllocation *crossModuleAllocation = nullptr;
+        if (this->isIsaDeduplicationAllowed()) {
+            auto isaImage = std::vector<uint8_t>(kernelsIsaTotalSize, 0u);
+            for (auto i = 0lu; i < kernelsCount; i++) {
+                auto &heapInfo = this->translationUnit->programInfo.kernelInfos[i]->heapInfo;
+                auto isaOffset = kernelsChunks[i].first;
+                memcpy_s(isaImage.data() + isaOffset, kernelsIsaTotalSize - isaOffset, heapInfo.pKernelHeap, heapInfo.kernelHeapSize);
+            }
+            crossModuleAllocation = isaAllocator.requestDeduplicatedIsa(this->type == ModuleType::builtin, std::move(isaImage));
+        } else {
+            crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
+        }
         if (crossModuleAllocation == nullptr) {
             return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
         }
@@ -844,6 +1009,15 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     return ZE_RESULT_SUCCESS;
 }
 
+bool ModuleImp::isIsaDeduplicationAllowed() const {
+    if (NEO::debugManager.flags.ShareIsaAcrossModules.get() != 1) {
+        return false;
+    }
+    // ISA patched by linker is specific to the module
+    auto &linkerInput = this->translationUnit->programInfo.linkerInput;
+    return (linkerInput == nullptr) || (linkerInput->getTraits().requiresPatchingOfInstructionSegments == false);
+}
+
 size_t ModuleImp::computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel) {
     auto isaPadding = lastKernel ? this->device->getGfxCoreHelper().getPaddingForISAAllocation() : 0u;
     auto kernelStartPointerAlignment = this->device->getGfxCoreHelper().getKernelIsaPointerAlignment();
@@ -876,7 +1050,11 @@ void ModuleImp::createDebugZebin() {
 }
 
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *kernelName) const {
+    auto lock = this->lockDeferredKernels();
     for (auto &kernelImmData : kernelImmDatas) {
+        if (false == kernelImmData->isInitialized()) {
+            continue;
+        }
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(kernelName) == 0) {
             return kernelImmData.get();
         }
@@ -972,6 +1150,11 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
     }
+    if (this->hasDeferredKernels) {
+        if (res = this->initializeDeferredKernelImmutableData(desc->pKernelName); res != ZE_RESULT_SUCCESS) {
+            return res;
+        }
+    }
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -1062,7 +1245,8 @@ bool ModuleImp::linkBinary() {
         isFullyLinked = true;
         return true;
     }
-    Linker linker(*linkerInput);
+    auto taskPool = this->device->getNEODevice()->getExecutionEnvironment()->initializeTaskPool();
+    Linker linker(*linkerInput, taskPool);
     Linker::SegmentInfo globals;
     Linker::SegmentInfo constants;
     Linker::SegmentInfo exportedFunctions;
@@ -1104,13 +1288,25 @@ bool ModuleImp::linkBinary() {
     Linker::KernelDescriptorsT kernelDescriptors;
 
     if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
-        patchedIsaTempStorage.reserve(this->kernelImmDatas.size());
+        const auto isaTempStorageOffset = patchedIsaTempStorage.size();
+        patchedIsaTempStorage.resize(isaTempStorageOffset + this->kernelImmDatas.size());
+        auto copyOriginalIsa = [&](size_t i) {
+            auto &kernHeapInfo = this->translationUnit->programInfo.kernelInfos.at(i)->heapInfo;
+            const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+            patchedIsaTempStorage[isaTempStorageOffset + i].assign(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize);
+        };
+        if (taskPool) {
+            taskPool->run(this->kernelImmDatas.size(), copyOriginalIsa);
+        } else {
+            for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+                copyOriginalIsa(i);
+            }
+        }
+
         kernelDescriptors.reserve(this->kernelImmDatas.size());
         for (size_t i = 0; i < kernelImmDatas.size(); i++) {
             auto kernelInfo = this->translationUnit->programInfo.kernelInfos.at(i);
             auto &kernHeapInfo = kernelInfo->heapInfo;
-            const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
-            patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
             uintptr_t isaAddressToPatch = 0;
             if (useFullAddress) {
                 isaAddressToPatch = static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddress() +
@@ -1120,7 +1316,7 @@ bool ModuleImp::linkBinary() {
                                                            kernelImmDatas.at(i)->getIsaOffsetInParentAllocation());
             }
 
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage[isaTempStorageOffset + i].data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -1180,6 +1376,11 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     // If the Function Pointer is not in the exported symbol table, then this function might be a kernel.
     // Check if the function name matches a kernel and return the gpu address to that function
     if (*pfnFunction == nullptr) {
+        if (this->hasDeferredKernels) {
+            if (auto result = this->initializeDeferredKernelImmutableData(pFunctionName); result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        }
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
@@ -1267,9 +1468,12 @@ ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
         *pCount = static_cast<uint32_t>(kernelImmDatas.size());
     }
 
+    auto lock = this->lockDeferredKernels();
     uint32_t outCount = 0;
     for (auto &kernelImmData : kernelImmDatas) {
-        *(pNames + outCount) = kernelImmData->getDescriptor().kernelMetadata.kernelName.c_str();
+        const auto &kernelName = kernelImmData->isInitialized() ? kernelImmData->getDescriptor().kernelMetadata.kernelName
+                                                                : translationUnit->programInfo.kernelInfos[outCount]->kernelDescriptor.kernelMetadata.kernelName;
+        *(pNames + outCount) = kernelName.c_str();
         outCount++;
         if (outCount == *pCount) {
             break;
@@ -1282,8 +1486,9 @@ ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
 void ModuleImp::checkIfPrivateMemoryPerDispatchIsNeeded() {
     size_t modulePrivateMemorySize = 0;
     auto neoDevice = this->device->getNEODevice();
+    // with deferred kernels only already created ones are accounted, decision is revisited on each first creation
     for (auto &kernelImmData : this->kernelImmDatas) {
-        if (0 == kernelImmData->getDescriptor().kernelAttributes.perHwThreadPrivateMemorySize) {
+        if ((false == kernelImmData->isInitialized()) || (0 == kernelImmData->getDescriptor().kernelAttributes.perHwThreadPrivateMemorySize)) {
             continue;
         }
         auto kernelPrivateMemorySize = NEO::KernelHelper::getPrivateSurfaceSize(kernelImmData->getDescriptor().kernelAttributes.perHwThreadPrivateMemorySize,
@@ -1291,13 +1496,14 @@ void ModuleImp::checkIfPrivateMemoryPerDispatchIsNeeded() {
         modulePrivateMemorySize += kernelPrivateMemorySize;
     }
 
-    this->allocatePrivateMemoryPerDispatch = false;
+    bool privateMemoryPerDispatch = false;
     if (modulePrivateMemorySize > 0U) {
         auto deviceBitfield = neoDevice->getDeviceBitfield();
         auto globalMemorySize = neoDevice->getRootDevice()->getGlobalMemorySize(static_cast<uint32_t>(deviceBitfield.to_ulong()));
         auto numSubDevices = deviceBitfield.count();
-        this->allocatePrivateMemoryPerDispatch = modulePrivateMemorySize * numSubDevices > globalMemorySize;
+        privateMemoryPerDispatch = modulePrivateMemorySize * numSubDevices > globalMemorySize;
     }
+    this->allocatePrivateMemoryPerDispatch = privateMemoryPerDispatch;
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
@@ -1442,6 +1648,19 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                     isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
                 }
             }
+            auto resolveSymbol = [&](const std::string &symbolName) -> std::pair<ModuleImp *, uint64_t> {
+                for (auto i = 0u; i < numModules; i++) {
+                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
+                    auto symbolIt = moduleHandle->symbols.find(symbolName);
+                    if (symbolIt != moduleHandle->symbols.end()) {
+                        return {moduleHandle, symbolIt->second.gpuAddress};
+                    }
+                }
+                return {nullptr, 0u};
+            };
+            // symbol ids are assigned by linker input when relocations are decoded, each symbol is looked up in modules once
+            const auto &relocationSymbolNames = moduleId->translationUnit->programInfo.linkerInput->getRelocationSymbolNames();
+            std::vector<std::optional<std::pair<ModuleImp *, uint64_t>>> resolvedSymbols(relocationSymbolNames.size());
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
                 if (moduleLinkLog) {
                     std::stringstream logMessage;
@@ -1449,23 +1668,28 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                << " Unresolved Symbol <" << unresolvedExternal.unresolvedRelocation.symbolName << ">";
                     unresolvedSymbolLogMessages.push_back(logMessage.str());
                 }
-                for (auto i = 0u; i < numModules; i++) {
-                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
-                    auto symbolIt = moduleHandle->symbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
-                    if (symbolIt != moduleHandle->symbols.end()) {
-                        auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
-                                                      static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
-
-                        NEO::Linker::patchAddress(relocAddress, symbolIt->second.gpuAddress, unresolvedExternal.unresolvedRelocation);
-                        numPatchedSymbols++;
+                std::pair<ModuleImp *, uint64_t> resolvedSymbol;
+                const auto symbolId = unresolvedExternal.unresolvedRelocation.symbolId;
+                if (symbolId < resolvedSymbols.size()) {
+                    auto &cachedSymbol = resolvedSymbols[symbolId];
+                    if (false == cachedSymbol.has_value()) {
+                        cachedSymbol = resolveSymbol(unresolvedExternal.unresolvedRelocation.symbolName);
+                    }
+                    resolvedSymbol = *cachedSymbol;
+                } else {
+                    resolvedSymbol = resolveSymbol(unresolvedExternal.unresolvedRelocation.symbolName);
+                }
+                if (resolvedSymbol.first != nullptr) {
+                    auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
+                                                  static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
 
-                        if (moduleLinkLog) {
-                            std::stringstream logMessage;
-                            logMessage << " Successfully Resolved Thru Dynamic Link to Module <" << moduleHandle << ">";
-                            unresolvedSymbolLogMessages.back().append(logMessage.str());
-                        }
+                    NEO::Linker::patchAddress(relocAddress, resolvedSymbol.second, unresolvedExternal.unresolvedRelocation);
+                    numPatchedSymbols++;
 
-                        break;
+                    if (moduleLinkLog) {
+                        std::stringstream logMessage;
+                        logMessage << " Successfully Resolved Thru Dynamic Link to Module <" << resolvedSymbol.first << ">";
+                        unresolvedSymbolLogMessages.back().append(logMessage.str());
                     }
                 }
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,8 +16,10 @@
 
 #include "igfxfmid.h"
 
+#include <atomic>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -61,6 +63,7 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL ze_result_t compileGenBinary(NEO::TranslationInput &inputArgs, bool staticLink);
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
+    ze_result_t decodeDeferredKernelDescriptors(const std::vector<NEO::KernelInfo *> &kernelInfos);
     L0::Device *device = nullptr;
 
     NEO::GraphicsAllocation *globalConstBuffer = nullptr;
@@ -167,8 +170,11 @@ struct ModuleImp : public Module {
   protected:
     MOCKABLE_VIRTUAL ze_result_t initializeTranslationUnit(const ze_module_desc_t *desc, NEO::Device *neoDevice);
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
+    ze_result_t decodeDeferredKernelDescriptorsIfRequired(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeDeferredKernelImmutableData(const char *kernelName);
+    std::unique_lock<std::mutex> lockDeferredKernels() const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -180,6 +186,7 @@ struct ModuleImp : public Module {
     ze_result_t setIsaGraphicsAllocations();
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    bool isIsaDeduplicationAllowed() const;
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
     StackVec<NEO::GraphicsAllocation *, 32> getModuleAllocations();
@@ -203,7 +210,8 @@ struct ModuleImp : public Module {
 
     bool builtFromSpirv = false;
     bool isFullyLinked = false;
-    bool allocatePrivateMemoryPerDispatch = true;
+    bool hasDeferredKernels = false;
+    std::atomic<bool> allocatePrivateMemoryPerDispatch{true};
     bool isZebinBinary = false;
     bool isFunctionSymbolExportEnabled = false;
     bool isGlobalSymbolExportEnabled = false;
@@ -219,6 +227,9 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    // guards kernel immutable datas initialized on first kernel creation, when descriptors of kernels were deferred
+    mutable std::mutex deferredKernelsMutex;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
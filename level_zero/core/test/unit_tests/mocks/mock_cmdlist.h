@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -197,6 +197,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::copyOperationFenceSupported;
     using BaseClass::copyOperationOffloadEnabled;
     using BaseClass::dcFlushSupport;
+    using BaseClass::deferredFlushWindow;
     using BaseClass::device;
     using BaseClass::disablePatching;
     using BaseClass::dispatchEventRemainingPacketsPostSyncOperation;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -522,6 +522,184 @@ HWTEST2_F(CommandListTest, givenImmediateCommandListWhenAppendMemoryRangesBarrie
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+HWTEST2_F(CommandListTest, givenDeferredFlushWindowEnabledWhenAppendingNonBlockingOperationsThenSubmissionIsDeferredUntilWindowIsFull, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(3);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    uint32_t numRanges = 1;
+    const size_t rangeSizes = 1;
+    const char *rangesBuffer[rangeSizes];
+    const void **ranges = reinterpret_cast<const void **>(&rangesBuffer[0]);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_EQ(3u, cmdList.deferredFlushWindow.maxAppends);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(2u, cmdList.deferredFlushWindow.numDeferredAppends);
+    EXPECT_TRUE(cmdList.deferredFlushWindow.hasStallingCmds);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+    EXPECT_FALSE(cmdList.deferredFlushWindow.hasStallingCmds);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListTest, givenDeferredAppendsAndSharedHeapsWhenFlushingKernelOperationOrAppendWithSignalEventThenAllAppendsAreSubmittedTogether, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.immediateCmdListHeapSharing = true;
+    cmdList.cmdListHeapAddressModel = NEO::HeapAddressModel::privateHeaps;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 1;
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, event->toHandle(), false));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+}
+
+HWTEST2_F(CommandListTest, givenDeferredFlushWindowWithZeroTimeBudgetWhenAppendingThenEachAppendIsSubmitted, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(0);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+}
+
+HWTEST2_F(CommandListTest, givenDeferredAppendsWhenEventIsHostSynchronizedThenDeferredAppendsAreSubmitted, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, driverHandle->numDeferredSubmissions.load());
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    event->hostSignal(false);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+    EXPECT_EQ(0u, driverHandle->numDeferredSubmissions.load());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListTest, givenDeferredAppendsAndCommandsEncodedAfterThemWhenHostWaitFlushesDeferredSubmissionsThenWindowIsLeftToItsAppend, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_TRUE(cmdList.deferredFlushWindow.flushableOnHostWait);
+
+    cmdList.checkAvailableSpace(0, false, commonImmediateCommandSize);
+    EXPECT_FALSE(cmdList.deferredFlushWindow.flushableOnHostWait);
+    driverHandle->flushDeferredSubmissions();
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.deferredFlushWindow.numDeferredAppends);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    EXPECT_EQ(2u, cmdList.deferredFlushWindow.numDeferredAppends);
+    EXPECT_TRUE(cmdList.deferredFlushWindow.flushableOnHostWait);
+
+    cmdList.commandContainer.getCommandStream()->getSpace(sizeof(uint32_t));
+    driverHandle->flushDeferredSubmissions();
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, false, false, nullptr, false));
+    driverHandle->flushDeferredSubmissions();
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+    EXPECT_EQ(0u, driverHandle->numDeferredSubmissions.load());
+}
+
 HWTEST2_F(CommandListTest, givenImmediateCommandListWhenFlushImmediateThenOverrideEventCsr, MatchAny) {
     ze_command_queue_desc_t queueDesc = {};
     auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
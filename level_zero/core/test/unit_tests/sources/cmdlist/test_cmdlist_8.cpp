@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -707,6 +709,60 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndThresholdDebug
     EXPECT_EQ(6 * MemoryConstants::megaByte, cmdList.getTransferThreshold(TransferType::deviceUsmToHostNonUsm));
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenCpuCopyWorkerThreadsNotSetWhenCopyH2DLargerThanChunkSizeThenCpuCopyTaskPoolIsNotCreated, MatchAny) {
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    const size_t copySize = NEO::CpuCopy::defaultChunkSize + 3;
+    for (size_t i = 0; i < copySize; i++) {
+        nonUsmHostPtr[i] = static_cast<char>(i % 251);
+    }
+
+    cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, copySize, nullptr, 0, nullptr, false, false);
+
+    EXPECT_EQ(nullptr, device->getNEODevice()->getExecutionEnvironment()->cpuCopyTaskPool.get());
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, copySize, allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, dstAlloc->getLockedPtr());
+    EXPECT_EQ(0, memcmp(dstAlloc->getLockedPtr(), nonUsmHostPtr, copySize));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenCpuCopyWorkerThreadsSetWhenCopyH2DLargerThanChunkSizeThenCopyIsSplitAcrossWorkersAndDataIsCopied, MatchAny) {
+    debugManager.flags.CpuCopyWorkerThreads.set(2);
+    debugManager.flags.ExperimentalCpuCopyChunkSize.set(64 * MemoryConstants::kiloByte);
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    const size_t copySize = 1 * MemoryConstants::megaByte + 3;
+    for (size_t i = 0; i < copySize; i++) {
+        nonUsmHostPtr[i] = static_cast<char>(i % 251);
+    }
+
+    auto executionEnvironment = device->getNEODevice()->getExecutionEnvironment();
+    EXPECT_EQ(nullptr, executionEnvironment->cpuCopyTaskPool.get());
+
+    cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, copySize, nullptr, 0, nullptr, false, false);
+
+    ASSERT_NE(nullptr, executionEnvironment->cpuCopyTaskPool.get());
+    EXPECT_EQ(2u, executionEnvironment->cpuCopyTaskPool->getNumWorkers());
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, copySize, allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, dstAlloc->getLockedPtr());
+    EXPECT_EQ(0, memcmp(dstAlloc->getLockedPtr(), nonUsmHostPtr, copySize));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrWhenCopyH2DThenLockPtr, MatchAny) {
     ze_command_queue_desc_t queueDesc = {};
     auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1529,6 +1529,99 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaun
     EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
 }
 
+HWTEST2_F(CommandListAppendLaunchKernelMockModule, givenDeferredFlushWindowWhenAppendingKernelsWithMatchingStateThenKernelsAreSubmittedInSingleFlushTask, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(2);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    ASSERT_FALSE(cmdList.immediateCmdListHeapSharing);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.deferredFlushWindow.numDeferredKernels);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredKernels);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.numDeferredAppends);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernelMockModule, givenDeferredKernelWhenAppendingKernelRequiringLargerScratchThenDeferredKernelIsSubmittedBeforeKernelIsEncoded, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.deferredFlushWindow.kernelPerThreadScratchSize[0]);
+
+    mockKernelImmData->kernelDescriptor->kernelAttributes.perThreadScratchSize[0] = 0x40;
+    EXPECT_FALSE(cmdList.isKernelMatchingDeferredFlushWindow(*kernel, groupCount, launchParams));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.deferredFlushWindow.numDeferredKernels);
+    EXPECT_EQ(0x40u, cmdList.deferredFlushWindow.kernelPerThreadScratchSize[0]);
+
+    EXPECT_TRUE(cmdList.isKernelMatchingDeferredFlushWindow(*kernel, groupCount, launchParams));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernelMockModule, givenDeferredKernelWhenCheckingIfKernelMatchesDeferredFlushWindowThenRequiredStreamStateIsNotChanged, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(8);
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(1000000);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.deferredFlushWindow.numDeferredKernels);
+
+    auto largeGrfModeBefore = cmdList.requiredStreamState.stateComputeMode.largeGrfMode.value;
+    auto systolicModeBefore = cmdList.requiredStreamState.pipelineSelect.systolicMode.value;
+    mockKernelImmData->kernelDescriptor->kernelAttributes.numGrfRequired = GrfConfig::largeGrfNumber;
+    mockKernelImmData->kernelDescriptor->kernelAttributes.flags.usesSystolicPipelineSelectMode = true;
+    cmdList.isKernelMatchingDeferredFlushWindow(*kernel, groupCount, launchParams);
+
+    EXPECT_EQ(largeGrfModeBefore, cmdList.requiredStreamState.stateComputeMode.largeGrfMode.value);
+    EXPECT_EQ(systolicModeBefore, cmdList.requiredStreamState.pipelineSelect.systolicMode.value);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+}
+
 HWTEST2_F(CommandListAppendLaunchKernel, whenUpdateStreamPropertiesIsCalledThenCorrectThreadArbitrationPolicyIsSet, MatchAny) {
     DebugManagerStateRestore restorer;
     debugManager.flags.ForceThreadArbitrationPolicyProgrammingWithScm.set(1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1335,6 +1335,47 @@ HWTEST2_F(ExecuteCommandListTests, givenFailingSubmitBatchBufferThenResetGraphic
     alignedFree(alloc);
 }
 
+HWTEST2_F(ExecuteCommandListTests, givenIncrementalResidencyAndFailingSubmitBatchBufferThenResetTaskCountsOfAllocationsSkippedByResidencyGeneration, MatchAny) {
+    ze_command_queue_desc_t desc = {};
+
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u, ZE_COMMAND_QUEUE_PRIORITY_NORMAL, false);
+    auto ultCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(csr);
+    auto contextId = csr->getOsContext().getContextId();
+    std::atomic<uint32_t> residencyGeneration{3u};
+    ultCsr->residencyGeneration = &residencyGeneration;
+
+    auto commandQueue = new MockCommandQueueSubmitBatchBuffer<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->submitBatchBufferResult = NEO::SubmissionStatus::failed;
+
+    commandQueue->initialize(false, false, false);
+    auto commandList = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    auto commandListHandle = commandList->toHandle();
+    commandList->close();
+
+    void *alloc = alignedMalloc(0x100, 0x100);
+    NEO::GraphicsAllocation residentAllocation(0, 1u /*num gmms*/, NEO::AllocationType::buffer, alloc, 0u, 0u, 1u, MemoryPool::system4KBPages, 1u);
+    NEO::GraphicsAllocation newAllocation(0, 1u /*num gmms*/, NEO::AllocationType::buffer, alloc, 0u, 0u, 1u, MemoryPool::system4KBPages, 1u);
+    residentAllocation.setResidencyGeneration(3u, contextId);
+    commandList->commandContainer.addToResidencyContainer(&residentAllocation);
+    commandList->commandContainer.addToResidencyContainer(&newAllocation);
+    ultCsr->taskCount = 2;
+    auto res = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false, nullptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, res);
+
+    auto expectedTaskCount = 2u;
+    EXPECT_EQ(expectedTaskCount, residentAllocation.getTaskCount(contextId));
+    EXPECT_EQ(expectedTaskCount, newAllocation.getTaskCount(contextId));
+    EXPECT_FALSE(residentAllocation.isResident(contextId));
+    EXPECT_TRUE(csr->getGenerationResidentAllocations().empty());
+
+    ultCsr->residencyGeneration = nullptr;
+    commandQueue->destroy();
+    commandList->destroy();
+    alignedFree(alloc);
+}
+
 HWTEST2_F(ExecuteCommandListTests, givenFailingSubmitBatchBufferThenWaitForCompletionFalse, MatchAny) {
 
     auto &compilerProductHelper = device->getCompilerProductHelper();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1098,6 +1098,81 @@ HWTEST2_F(CommandQueueTest, givenRegularKernelScheduledAsCooperativeWhenExecuteC
     commandQueue->destroy();
 }
 
+HWTEST2_F(CommandQueueTest, givenSameClosedCommandListsExecutedAgainWhenExecuteCommandListsIsCalledThenMergedResidencyOfExecutionPlanIsUsed, MatchAny) {
+    ze_command_queue_desc_t desc = {};
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto commandQueue = new MockCommandQueueHw<gfxCoreFamily>{device, csr, &desc};
+    commandQueue->initialize(false, false, false);
+
+    MockGraphicsAllocation allocationA;
+    MockGraphicsAllocation allocationB;
+    MockGraphicsAllocation sharedAllocation;
+
+    auto commandListA = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandListA->initialize(device, NEO::EngineGroupType::compute, 0u);
+    commandListA->getCmdContainer().addToResidencyContainer(&allocationA);
+    commandListA->getCmdContainer().addToResidencyContainer(&sharedAllocation);
+    commandListA->close();
+
+    auto commandListB = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandListB->initialize(device, NEO::EngineGroupType::compute, 0u);
+    commandListB->getCmdContainer().addToResidencyContainer(&allocationB);
+    commandListB->getCmdContainer().addToResidencyContainer(&sharedAllocation);
+    commandListB->close();
+
+    ze_command_list_handle_t commandLists[] = {commandListA->toHandle(), commandListB->toHandle()};
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false, nullptr);
+    EXPECT_EQ(2u, commandQueue->executionPlan.entries.size());
+    EXPECT_FALSE(commandQueue->executionPlan.built);
+
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false, nullptr);
+    EXPECT_TRUE(commandQueue->executionPlan.built);
+
+    auto &planResidency = commandQueue->executionPlan.residencyContainer;
+    EXPECT_EQ(1, std::count(planResidency.begin(), planResidency.end(), &allocationA));
+    EXPECT_EQ(1, std::count(planResidency.begin(), planResidency.end(), &allocationB));
+    EXPECT_EQ(1, std::count(planResidency.begin(), planResidency.end(), &sharedAllocation));
+
+    auto &submittedResidency = commandQueue->residencyContainerSnapshot;
+    EXPECT_NE(submittedResidency.end(), std::find(submittedResidency.begin(), submittedResidency.end(), &allocationA));
+    EXPECT_NE(submittedResidency.end(), std::find(submittedResidency.begin(), submittedResidency.end(), &allocationB));
+    EXPECT_NE(submittedResidency.end(), std::find(submittedResidency.begin(), submittedResidency.end(), &sharedAllocation));
+
+    commandListB->reset();
+    commandListB->close();
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false, nullptr);
+    EXPECT_FALSE(commandQueue->executionPlan.built);
+    EXPECT_EQ(0, std::count(planResidency.begin(), planResidency.end(), &allocationB));
+
+    ze_command_list_handle_t reorderedCommandLists[] = {commandListB->toHandle(), commandListA->toHandle()};
+    commandQueue->executeCommandLists(2, reorderedCommandLists, nullptr, false, nullptr);
+    EXPECT_FALSE(commandQueue->executionPlan.built);
+
+    commandQueue->destroy();
+}
+
+HWTEST2_F(CommandQueueTest, givenExecutionPlanDisabledWhenSameCommandListsAreExecutedAgainThenPlanIsNotRecorded, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableCommandListsExecutionPlan.set(0);
+
+    ze_command_queue_desc_t desc = {};
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto commandQueue = new MockCommandQueueHw<gfxCoreFamily>{device, csr, &desc};
+    commandQueue->initialize(false, false, false);
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    commandList->close();
+
+    ze_command_list_handle_t commandLists[] = {commandList->toHandle()};
+    commandQueue->executeCommandLists(1, commandLists, nullptr, false, nullptr);
+    commandQueue->executeCommandLists(1, commandLists, nullptr, false, nullptr);
+    EXPECT_TRUE(commandQueue->executionPlan.entries.empty());
+    EXPECT_FALSE(commandQueue->executionPlan.built);
+
+    commandQueue->destroy();
+}
+
 HWTEST2_F(CommandQueueTest, givenTwoCommandQueuesUsingOneCsrWhenExecuteCommandListsIsCalledThenCorrectSizeOfFrontEndCmdsIsCalculated, IsAtLeastXeHpCore) {
     ze_command_queue_desc_t desc = {};
     NEO::CommandStreamReceiver *csr = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1346,6 +1346,103 @@ TEST_F(EventPoolCreate, whenAllocationMemoryFailsThenEventAllocationIsNotCreated
     EXPECT_EQ(nullptr, eventPool);
 }
 
+TEST_F(EventPoolCreate, givenEventPoolAllocationsCacheEnabledWhenPoolIsDestroyedThenAllocationIsReusedByCompatiblePoolAndEventsAreReset) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EventPoolAllocationsCacheSize.set(2);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 1;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto rootDeviceIndex = device->getNEODevice()->getRootDeviceIndex();
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex);
+
+    ze_event_handle_t hEvent = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &hEvent));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::fromHandle(hEvent)->hostSignal(false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::fromHandle(hEvent)->queryStatus());
+    L0::Event::fromHandle(hEvent)->destroy();
+
+    eventPool.reset();
+    EXPECT_EQ(1u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(allocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(0u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &hEvent));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::Event::fromHandle(hEvent)->queryStatus());
+    L0::Event::fromHandle(hEvent)->destroy();
+}
+
+TEST_F(EventPoolCreate, givenEventPoolAllocationsCacheEnabledWhenPoolIsIncompatibleOrIpcThenAllocationIsNotReused) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EventPoolAllocationsCacheSize.set(2);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto rootDeviceIndex = device->getNEODevice()->getRootDeviceIndex();
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex);
+    eventPool.reset();
+    EXPECT_EQ(1u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(allocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(1u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+    eventPool.reset();
+    EXPECT_EQ(2u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC;
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(allocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(2u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+    eventPool.reset();
+    EXPECT_EQ(2u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolAllocationsCacheFullOrDisabledWhenPoolIsDestroyedThenAllocationIsFreed) {
+    DebugManagerStateRestore restore;
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    eventPool.reset();
+    EXPECT_EQ(0u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+
+    NEO::debugManager.flags.EventPoolAllocationsCacheSize.set(1);
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    eventPool0.reset();
+    eventPool1.reset();
+    EXPECT_EQ(1u, driverHandle->eventPoolAllocationsCache.getNumCachedAllocations());
+}
+
 TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamReceiverSet) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -156,6 +157,81 @@ HWTEST_F(ModuleTest, givenNonZeroCountWhenGettingKernelNamesThenNamesAreReturned
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+HWTEST_F(ModuleTest, givenDeferredZeInfoKernelsDecodingWhenModuleIsCreatedThenKernelDescriptorIsDecodedAndImmutableDataInitializedOnFirstKernelCreation) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DeferZeInfoKernelsDecoding.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+    ASSERT_NE(nullptr, module);
+
+    auto whiteboxModule = whiteboxCast(module.get());
+    auto &kernelInfos = whiteboxModule->translationUnit->programInfo.kernelInfos;
+    auto &kernelImmDatas = whiteboxModule->kernelImmDatas;
+    ASSERT_EQ(2u, kernelInfos.size());
+    ASSERT_EQ(2u, kernelImmDatas.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        EXPECT_TRUE(kernelInfos[i]->isKernelDescriptorDeferred());
+        EXPECT_FALSE(kernelImmDatas[i]->isInitialized());
+        EXPECT_NE(nullptr, kernelImmDatas[i]->getIsaGraphicsAllocation());
+    }
+
+    uint32_t count = 2;
+    const char *kernelNames[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&count, kernelNames));
+    EXPECT_STREQ("test", kernelNames[0]);
+    EXPECT_STREQ("memcpy_bytes_attr", kernelNames[1]);
+    EXPECT_EQ(nullptr, module->getKernelImmutableData("test"));
+
+    ze_kernel_handle_t kernelHandle;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = "test";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+
+    EXPECT_FALSE(kernelInfos[0]->isKernelDescriptorDeferred());
+    EXPECT_TRUE(kernelImmDatas[0]->isInitialized());
+    EXPECT_EQ(32u, kernelImmDatas[0]->getDescriptor().kernelAttributes.simdSize);
+    EXPECT_EQ(kernelImmDatas[0].get(), module->getKernelImmutableData("test"));
+    EXPECT_TRUE(kernelInfos[1]->isKernelDescriptorDeferred());
+    EXPECT_FALSE(kernelImmDatas[1]->isInitialized());
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+HWTEST_F(ModuleTest, givenModuleInitWorkerThreadsWhenModuleIsCreatedThenImmutableDatasAreInitializedByTaskPool) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ModuleInitWorkerThreads.set(2);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+    ASSERT_NE(nullptr, module);
+
+    auto whiteboxModule = whiteboxCast(module.get());
+    auto &kernelInfos = whiteboxModule->translationUnit->programInfo.kernelInfos;
+    auto &kernelImmDatas = whiteboxModule->kernelImmDatas;
+    ASSERT_EQ(2u, kernelImmDatas.size());
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        EXPECT_TRUE(kernelImmDatas[i]->isInitialized());
+        EXPECT_EQ(kernelInfos[i], kernelImmDatas[i]->getKernelInfo());
+    }
+    auto taskPool = device->getNEODevice()->getExecutionEnvironment()->taskPool.get();
+    ASSERT_NE(nullptr, taskPool);
+    EXPECT_EQ(2u, taskPool->getNumWorkers());
+}
+
+HWTEST_F(ModuleTest, givenModuleInitWorkerThreadsAndDeferredZeInfoKernelsDecodingWhenModuleIsCreatedThenDeferredKernelsAreNotInitialized) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ModuleInitWorkerThreads.set(2);
+    debugManager.flags.DeferZeInfoKernelsDecoding.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+    ASSERT_NE(nullptr, module);
+
+    auto &kernelImmDatas = whiteboxCast(module.get())->kernelImmDatas;
+    ASSERT_EQ(2u, kernelImmDatas.size());
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+    }
+}
+
 HWTEST_F(ModuleTest, givenUserModuleTypeWhenCreatingModuleThenCorrectTypeIsSet) {
     WhiteBox<Module> module(device, nullptr, ModuleType::user);
     EXPECT_EQ(ModuleType::user, module.type);
@@ -765,6 +841,46 @@ HWTEST_F(ModuleTest, whenMultipleModulesCreatedThenModulesShareIsaAllocation) {
     EXPECT_EQ(initialWriteMemoryCount + 1, ultCsr.writeMemoryParams.totalCallCount);
 };
 
+HWTEST_F(ModuleTest, givenShareIsaAcrossModulesEnabledWhenIdenticalModulesCreatedThenIsaIsUploadedOnceAndReleasedWithLastModule) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalMemory.set(1);
+    debugManager.flags.ShareIsaAcrossModules.set(1);
+    uint8_t binary[10];
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = 10;
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.commandStreamReceiverType = CommandStreamReceiverType::aub;
+    auto initialWriteMemoryCount = ultCsr.writeMemoryParams.totalCallCount;
+    auto &isaAllocator = neoDevice->getIsaPoolAllocator();
+
+    auto firstModule = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, ModuleType::user);
+    firstModule->initialize(&moduleDesc, neoDevice);
+    if (!firstModule->isIsaDeduplicationAllowed() || firstModule->getKernelsIsaParentAllocation() == nullptr) {
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(initialWriteMemoryCount + 1, ultCsr.writeMemoryParams.totalCallCount);
+    EXPECT_EQ(1u, isaAllocator.getNumDeduplicatedIsas());
+
+    auto secondModule = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, ModuleType::user);
+    secondModule->initialize(&moduleDesc, neoDevice);
+    EXPECT_EQ(initialWriteMemoryCount + 1, ultCsr.writeMemoryParams.totalCallCount);
+    EXPECT_EQ(1u, isaAllocator.getNumDeduplicatedIsas());
+
+    EXPECT_EQ(firstModule->getKernelsIsaParentAllocation(), secondModule->getKernelsIsaParentAllocation());
+    ASSERT_EQ(firstModule->kernelImmDatas.size(), secondModule->kernelImmDatas.size());
+    for (auto i = 0u; i < firstModule->kernelImmDatas.size(); i++) {
+        EXPECT_EQ(firstModule->kernelImmDatas[i]->getIsaOffsetInParentAllocation(), secondModule->kernelImmDatas[i]->getIsaOffsetInParentAllocation());
+        EXPECT_TRUE(secondModule->kernelImmDatas[i]->isIsaCopiedToAllocation());
+    }
+
+    firstModule.reset();
+    EXPECT_EQ(1u, isaAllocator.getNumDeduplicatedIsas());
+    secondModule.reset();
+    EXPECT_EQ(0u, isaAllocator.getNumDeduplicatedIsas());
+}
+
 template <typename T1, typename T2>
 struct ModuleSpecConstantsFixture : public DeviceFixture {
     void setUp() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,16 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 
 namespace NEO {
@@ -42,9 +46,15 @@ Event *AsyncEventsHandler::processList() {
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
+    retireIndexedEvents();
+
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+            if (auto csr = getCompletionIndexCsr(event)) {
+                addToCompletionIndex(csr, event);
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -55,10 +65,61 @@ Event *AsyncEventsHandler::processList() {
         }
     }
 
+    for (auto &indexedEvents : completionIndex) {
+        auto &earliestEvent = indexedEvents.second.front();
+        if (earliestEvent.taskCount < lowestTaskCount) {
+            sleepCandidate = earliestEvent.event;
+            lowestTaskCount = earliestEvent.taskCount;
+        }
+    }
+
     list.swap(pendingList);
     return sleepCandidate;
 }
 
+CommandStreamReceiver *AsyncEventsHandler::getCompletionIndexCsr(Event *event) {
+    if (event->isExternallySynchronized() || event->getCommandQueue() == nullptr ||
+        event->peekExecutionStatus() != CL_SUBMITTED || event->peekTaskCount() == CompletionStamp::notReady) {
+        return nullptr;
+    }
+    return &event->getCommandQueue()->getGpgpuCommandStreamReceiver();
+}
+
+void AsyncEventsHandler::addToCompletionIndex(CommandStreamReceiver *csr, Event *event) {
+    auto &indexedEvents = completionIndex[csr];
+    indexedEvents.push_back({event->peekTaskCount(), event});
+    std::push_heap(indexedEvents.begin(), indexedEvents.end(), std::greater<>());
+}
+
+void AsyncEventsHandler::retireIndexedEvents() {
+    // retired events are updated with the rest of list, ones still not completed (e.g. waiting for copy engine) are indexed again
+    for (auto it = completionIndex.begin(); it != completionIndex.end();) {
+        auto csr = it->first;
+        auto &indexedEvents = it->second;
+        while (!indexedEvents.empty() && csr->testTaskCountReady(csr->getTagAddress(), indexedEvents.front().taskCount)) {
+            list.push_back(indexedEvents.front().event);
+            std::pop_heap(indexedEvents.begin(), indexedEvents.end(), std::greater<>());
+            indexedEvents.pop_back();
+        }
+        it = indexedEvents.empty() ? completionIndex.erase(it) : std::next(it);
+    }
+}
+
+void AsyncEventsHandler::abortIndexedEvents(CommandStreamReceiver *csr) {
+    // tag will not advance after gpu hang, aborted events are removed with callbacks executed on next iteration
+    auto it = completionIndex.find(csr);
+    if (it == completionIndex.end()) {
+        return;
+    }
+    for (auto &indexedEvent : it->second) {
+        if (!csr->testTaskCountReady(csr->getTagAddress(), indexedEvent.taskCount)) {
+            indexedEvent.event->abortExecutionDueToGpuHang();
+        }
+        list.push_back(indexedEvent.event);
+    }
+    completionIndex.erase(it);
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -73,7 +134,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasEvents()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -83,6 +144,9 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             waitStatus = sleepCandidate->wait(true, true);
             if (waitStatus == WaitStatus::gpuHang) {
                 sleepCandidate->abortExecutionDueToGpuHang();
+                if (sleepCandidate->getCommandQueue()) {
+                    self->abortIndexedEvents(&sleepCandidate->getCommandQueue()->getGpgpuCommandStreamReceiver());
+                }
             }
         }
         std::this_thread::yield();
@@ -119,6 +183,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &indexedEvents : completionIndex) {
+        for (auto &indexedEvent : indexedEvents.second) {
+            indexedEvent.event->decRefInternal();
+        }
+    }
+    completionIndex.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
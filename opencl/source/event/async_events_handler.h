@@ -1,18 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,15 +28,31 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    struct IndexedEvent {
+        TaskCountType taskCount;
+        Event *event;
+        bool operator>(const IndexedEvent &other) const { return taskCount > other.taskCount; }
+    };
+
     Event *processList();
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
+    static CommandStreamReceiver *getCompletionIndexCsr(Event *event);
+    void addToCompletionIndex(CommandStreamReceiver *csr, Event *event);
+    void retireIndexedEvents();
+    void abortIndexedEvents(CommandStreamReceiver *csr);
+    bool hasEvents() const { return !list.empty() || !completionIndex.empty(); }
+
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
 
+    // Submitted events waiting only for completion, kept in per CSR min-heaps ordered by task count.
+    // Events are retired when CSR tag passes their task count instead of being polled on each iteration.
+    std::unordered_map<CommandStreamReceiver *, std::vector<IndexedEvent>> completionIndex;
+
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
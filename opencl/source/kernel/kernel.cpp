@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -2348,7 +2348,11 @@ void Kernel::initializeLocalIdsCache() {
     auto simdSize = getDescriptor().kernelAttributes.simdSize;
     auto grfCount = getDescriptor().kernelAttributes.numGrfRequired;
     auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
-    localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, grfCount, simdSize, grfSize, usingImagesOnly);
+    size_t localIdsCacheSize = LocalIdsCache::defaultCacheSize;
+    if (debugManager.flags.LocalIdsCacheSize.get() > 0) {
+        localIdsCacheSize = static_cast<size_t>(debugManager.flags.LocalIdsCacheSize.get());
+    }
+    localIdsCache = std::make_unique<LocalIdsCache>(localIdsCacheSize, wgDimOrder, grfCount, simdSize, grfSize, usingImagesOnly);
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
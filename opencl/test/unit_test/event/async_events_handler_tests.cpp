@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -377,6 +377,60 @@ TEST_F(AsyncEventsHandlerTests, givenSleepCandidateAndGpuHangWhenProcessedThenCa
     event1->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWithCallbacksWhenCsrTagPassesTaskCountThenOnlyEventsBelowTagAreRetired) {
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+    const TaskCountType initialTag = commandQueue->getHeaplessStateInitEnabled() ? 1 : 0;
+
+    event1->setTaskStamp(0, initialTag + 1);
+    event2->setTaskStamp(0, initialTag + 2);
+    event3->setTaskStamp(0, initialTag + 3);
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event3.get());
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    handler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    auto &csr = commandQueue->getGpgpuCommandStreamReceiver();
+    ASSERT_EQ(1u, handler->completionIndex.size());
+    EXPECT_EQ(3u, handler->completionIndex[&csr].size());
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+
+    *csr.getTagAddress() = initialTag + 2;
+    EXPECT_EQ(event3.get(), handler->process());
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(0, event3Counter);
+    EXPECT_EQ(1u, handler->completionIndex[&csr].size());
+    EXPECT_EQ(1, event1->getRefInternalCount());
+    EXPECT_EQ(1, event2->getRefInternalCount());
+
+    *csr.getTagAddress() = initialTag + 3;
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenIndexedEventsAndGpuHangWhenSleepCandidateIsWaitedThenAllIndexedEventsOfCsrAreAborted) {
+    event1->setTaskStamp(0, commandQueue->getHeaplessStateInitEnabled() ? 2 : 1);
+    event2->setTaskStamp(0, commandQueue->getHeaplessStateInitEnabled() ? 3 : 2);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    event1->handler->registerEvent(event1.get());
+    event1->handler->registerEvent(event2.get());
+    event1->handler->allowAsyncProcess.store(true);
+    event1->waitResult = WaitStatus::gpuHang;
+
+    MockHandler::asyncProcess(event1->handler.get());
+
+    EXPECT_EQ(1u, event1->waitCalled);
+    EXPECT_EQ(0u, event2->waitCalled);
+    EXPECT_EQ(Event::executionAbortedDueToGpuHang, event1->peekExecutionStatus());
+    EXPECT_EQ(Event::executionAbortedDueToGpuHang, event2->peekExecutionStatus());
+    EXPECT_TRUE(event1->handler->peekIsListEmpty());
+}
+
 TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList) {
     Event *event = new Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
 
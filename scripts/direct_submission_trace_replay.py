@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Replays binary trace dumped by direct submission (DirectSubmissionTraceEntries debug key)
+# and prints submission latency distributions.
+# Usage: direct_submission_trace_replay.py ulls_trace_<pid>_<root device>_<context>[_gpu_hang].bin [--csv]
+
+import struct
+import sys
+
+HEADER_FORMAT = "<IIIIQ"
+ENTRY_FORMAT = "<QQQQIIIHH"
+FILE_MAGIC = 0x534C4C55
+FILE_VERSION = 1
+
+FLAGS = [
+    (1 << 0, "ring_start"),
+    (1 << 1, "ring_switch"),
+    (1 << 2, "monitor_fence"),
+    (1 << 3, "relaxed_ordering"),
+    (1 << 4, "paging_fence"),
+    (1 << 5, "submit_failed"),
+    (1 << 6, "gpu_hang"),
+]
+
+
+def read_trace(file_name):
+    with open(file_name, "rb") as trace_file:
+        data = trace_file.read()
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if len(data) < header_size:
+        sys.exit("%s: file too short" % file_name)
+    magic, version, entry_size, entry_count, dropped = struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != FILE_MAGIC or version != FILE_VERSION or entry_size != struct.calcsize(ENTRY_FORMAT):
+        sys.exit("%s: unsupported trace format" % file_name)
+
+    entries = []
+    for index in range(entry_count):
+        fields = struct.unpack_from(ENTRY_FORMAT, data, header_size + index * entry_size)
+        entries.append({
+            "dispatch_start_ns": fields[0],
+            "submit_end_ns": fields[1],
+            "gpu_va": fields[2],
+            "tag_value": fields[3],
+            "dispatch_size": fields[4],
+            "queue_work_count": fields[5],
+            "paging_fence_value": fields[6],
+            "ring_buffer_index": fields[7],
+            "flags": fields[8],
+        })
+    return entries, dropped
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def print_distribution(name, values):
+    values = sorted(values)
+    if not values:
+        print("%-28s no samples" % name)
+        return
+    average = sum(values) / len(values)
+    print("%-28s count %8d  avg %10.0f  p50 %10d  p90 %10d  p99 %10d  max %10d" % (
+        name, len(values), average,
+        percentile(values, 0.5), percentile(values, 0.9), percentile(values, 0.99), values[-1]))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit("usage: %s <trace file> [--csv]" % argv[0])
+    entries, dropped = read_trace(argv[1])
+
+    if "--csv" in argv[2:]:
+        print(",".join(["dispatch_start_ns", "submit_end_ns", "gpu_va", "tag_value", "dispatch_size",
+                        "queue_work_count", "paging_fence_value", "ring_buffer_index", "flags"]))
+        for entry in entries:
+            print(",".join(str(entry[key]) for key in ["dispatch_start_ns", "submit_end_ns", "gpu_va", "tag_value", "dispatch_size",
+                                                        "queue_work_count", "paging_fence_value", "ring_buffer_index", "flags"]))
+        return
+
+    print("entries: %d, dropped (overwritten): %d" % (len(entries), dropped))
+    for flag, name in FLAGS:
+        print("%-28s %d" % (name, sum(1 for entry in entries if entry["flags"] & flag)))
+
+    print("latencies in ns:")
+    print_distribution("dispatch to submit", [entry["submit_end_ns"] - entry["dispatch_start_ns"] for entry in entries])
+    print_distribution("dispatch to submit (start)", [entry["submit_end_ns"] - entry["dispatch_start_ns"] for entry in entries if entry["flags"] & FLAGS[0][0]])
+    print_distribution("dispatch to submit (switch)", [entry["submit_end_ns"] - entry["dispatch_start_ns"] for entry in entries if entry["flags"] & FLAGS[1][0]])
+    print_distribution("gap between submissions", [current["dispatch_start_ns"] - previous["submit_end_ns"] for previous, current in zip(entries, entries[1:])])
+    print_distribution("dispatch size in bytes", [entry["dispatch_size"] for entry in entries])
+
+
+if __name__ == "__main__":
+    main(sys.argv)
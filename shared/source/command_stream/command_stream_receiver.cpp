@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,6 +156,12 @@ void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
     gfxAllocation.updateTaskCount(submissionTaskCount, osContext->getContextId());
 
     if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
+        if (this->residencyGeneration && gfxAllocation.getResidencyGeneration(osContext->getContextId()) == this->residencyGeneration->load(std::memory_order_acquire)) {
+            gfxAllocation.updateResidencyTaskCount(submissionTaskCount, osContext->getContextId());
+            this->generationResidentAllocations.push_back(&gfxAllocation);
+            return;
+        }
+
         auto pushAllocations = true;
 
         if (debugManager.flags.MakeEachAllocationResident.get() != -1) {
@@ -199,8 +205,12 @@ void CommandStreamReceiver::makeSurfacePackNonResident(ResidencyContainer &alloc
     for (auto &surface : allocationsForResidency) {
         this->makeNonResident(*surface);
     }
+    for (auto &surface : this->generationResidentAllocations) {
+        this->makeNonResident(*surface);
+    }
     if (clearAllocations) {
         allocationsForResidency.clear();
+        this->generationResidentAllocations.clear();
     }
     this->processEviction();
 }
@@ -385,7 +395,12 @@ bool CommandStreamReceiver::isGpuHangDetected() const {
         return false;
     }
 
-    return this->osContext && this->getOSInterface() && this->getOSInterface()->getDriverModel() && this->getOSInterface()->getDriverModel()->isGpuHangDetected(*osContext);
+    const bool gpuHangDetected = this->osContext && this->getOSInterface() && this->getOSInterface()->getDriverModel() && this->getOSInterface()->getDriverModel()->isGpuHangDetected(*osContext);
+    if (gpuHangDetected) {
+        // covers hangs found while polling, which never reach direct submission on drm
+        dumpDirectSubmissionTraceOnGpuHang();
+    }
+    return gpuHangDetected;
 }
 
 void CommandStreamReceiver::cleanupResources() {
@@ -625,6 +640,11 @@ ResidencyContainer &CommandStreamReceiver::getResidencyAllocations() {
 ResidencyContainer &CommandStreamReceiver::getEvictionAllocations() {
     return this->evictionAllocations;
 }
+
+ResidencyContainer &CommandStreamReceiver::getGenerationResidentAllocations() {
+    return this->generationResidentAllocations;
+}
+
 PrivateAllocsToReuseContainer &CommandStreamReceiver::getOwnedPrivateAllocations() {
     return this->ownedPrivateAllocations;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -136,6 +136,7 @@ class CommandStreamReceiver {
 
     ResidencyContainer &getResidencyAllocations();
     ResidencyContainer &getEvictionAllocations();
+    ResidencyContainer &getGenerationResidentAllocations();
     PrivateAllocsToReuseContainer &getOwnedPrivateAllocations();
 
     virtual GmmPageTableMngr *createPageTableManager() { return nullptr; }
@@ -380,6 +381,7 @@ class CommandStreamReceiver {
     }
 
     virtual void stopDirectSubmission(bool blocking) {}
+    virtual void dumpDirectSubmissionTraceOnGpuHang() const {}
 
     virtual QueueThrottle getLastDirectSubmissionThrottle() = 0;
 
@@ -588,6 +590,10 @@ class CommandStreamReceiver {
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
+    // set when incremental residency is used, allocations resident at current generation are not added to residencyAllocations
+    const std::atomic<uint32_t> *residencyGeneration = nullptr;
+    // allocations skipped by incremental residency, their task counts are rolled back and released together with residencyAllocations
+    ResidencyContainer generationResidentAllocations;
     PrivateAllocsToReuseContainer ownedPrivateAllocations;
 
     MutexType ownershipMutex;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -158,6 +158,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     bool directSubmissionRelaxedOrderingEnabled() const override;
 
     void stopDirectSubmission(bool blocking) override;
+    void dumpDirectSubmissionTraceOnGpuHang() const override;
 
     QueueThrottle getLastDirectSubmissionThrottle() override;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1361,6 +1361,16 @@ inline void CommandStreamReceiverHw<GfxFamily>::stopDirectSubmission(bool blocki
     }
 }
 
+template <typename GfxFamily>
+inline void CommandStreamReceiverHw<GfxFamily>::dumpDirectSubmissionTraceOnGpuHang() const {
+    if (this->directSubmission) {
+        this->directSubmission->dumpTraceOnGpuHang();
+    }
+    if (this->blitterDirectSubmission) {
+        this->blitterDirectSubmission->dumpTraceOnGpuHang();
+    }
+}
+
 template <typename GfxFamily>
 inline QueueThrottle CommandStreamReceiverHw<GfxFamily>::getLastDirectSubmissionThrottle() {
     if (this->isAnyDirectSubmissionEnabled()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
@@ -20,9 +20,7 @@
 #include "os_inc.h"
 
 #include <cstring>
-#include <iomanip>
 #include <mutex>
-#include <sstream>
 #include <string>
 
 namespace NEO {
@@ -32,7 +30,14 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
                                                    const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
-    Hash hash;
+    return getCachedFileName(hwInfo, getHwInfoDigest(hwInfo), input, options, internalOptions, specIds, specValues, igcRevision, igcLibSize, igcLibMTime);
+}
+
+const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const Hash128::Digest &hwInfoDigest, const ArrayRef<const char> input,
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
+                                                   const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*igcRevision.begin(), igcRevision.size());
@@ -49,29 +54,14 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(&*specIds.begin(), specIds.size());
     hash.update(&*specValues.begin(), specValues.size());
     hash.update("----", 4);
-    hash.update(safePodCast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
-    hash.update("----", 4);
-
-    const auto featureTableHashStr = std::to_string(hwInfo.featureTable.asHash());
-    hash.update(featureTableHashStr.c_str(), featureTableHashStr.length());
-    hash.update("----", 4);
 
-    const auto workaroundTableHashStr = std::to_string(hwInfo.workaroundTable.asHash());
-    hash.update(workaroundTableHashStr.c_str(), workaroundTableHashStr.length());
-    hash.update("----", 4);
-
-    hash.update(reinterpret_cast<const char *>(&hwInfo.ipVersion), sizeof(uint32_t));
+    hash.update(safePodCast<const char *>(&hwInfoDigest), sizeof(hwInfoDigest));
 
-    auto res = hash.finish();
-    std::stringstream stream;
-    stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
-           << std::hex
-           << res;
+    const auto cachedFileName = hash.finish().toString();
 
     if (debugManager.flags.BinaryCacheTrace.get()) {
-        std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
-        std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".input";
+        std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + cachedFileName + ".trace";
+        std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + cachedFileName + ".input";
         std::lock_guard<std::mutex> lock(cacheAccessMtx);
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
@@ -132,10 +122,31 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
         }
     }
 
-    return stream.str();
+    return cachedFileName;
+}
+
+Hash128::Digest CompilerCache::getHwInfoDigest(const HardwareInfo &hwInfo) {
+    Hash128 hash;
+    hash.update(safePodCast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
+    hash.update(safePodCast<const char *>(&hwInfo.featureTable.packed), sizeof(hwInfo.featureTable.packed));
+    hash.update(safePodCast<const char *>(&hwInfo.workaroundTable.packed), sizeof(hwInfo.workaroundTable.packed));
+    hash.update(safePodCast<const char *>(&hwInfo.ipVersion.value), sizeof(hwInfo.ipVersion.value));
+    return hash.finish();
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (config.enabled && config.memoryTierSize > 0u) {
+        memoryTier = std::make_unique<CompilerCacheMemoryTier>(config.memoryTierSize);
+    }
+    if (config.enabled && config.asyncWriteback) {
+        asyncWriter = std::make_unique<CompilerCacheAsyncWriter>(*this, CompilerCacheAsyncWriter::defaultMaxQueuedSize);
+    }
+};
+
+CompilerCache::~CompilerCache() {
+    // derived caches must stop writer in their destructors, as it calls virtual cacheBinary
+    asyncWriter.reset();
+}
 
 } // namespace NEO
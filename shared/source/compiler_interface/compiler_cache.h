@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "shared/source/compiler_interface/compiler_cache_async_writer.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/os_interface/os_handle.h"
 #include "shared/source/utilities/arrayref.h"
 
@@ -24,12 +27,17 @@ struct CompilerCacheConfig {
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    bool useIndexedStore = false;
+    size_t memoryTierSize = 0;
+    bool asyncWriteback = false;
 };
 
 class CompilerCache {
   public:
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
+
+    static std::unique_ptr<CompilerCache> create(const CompilerCacheConfig &config);
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -39,13 +47,28 @@ class CompilerCache {
         return config;
     }
 
+    CompilerCacheMemoryTier *getMemoryTier() const {
+        return memoryTier.get();
+    }
+
+    CompilerCacheAsyncWriter *getAsyncWriter() const {
+        return asyncWriter.get();
+    }
+
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
                                         ArrayRef<const char> specIds, ArrayRef<const char> specValues,
                                         ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime);
+    const std::string getCachedFileName(const HardwareInfo &hwInfo, const Hash128::Digest &hwInfoDigest, ArrayRef<const char> input,
+                                        ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                        ArrayRef<const char> specIds, ArrayRef<const char> specValues,
+                                        ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime);
+
+    // per-HardwareInfo part of the key, callers compiling repeatedly for the same device should compute it once
+    static Hash128::Digest getHwInfoDigest(const HardwareInfo &hwInfo);
 
-    MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
-    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
+    virtual bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    virtual std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
   protected:
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
@@ -55,5 +78,7 @@ class CompilerCache {
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    std::unique_ptr<CompilerCacheMemoryTier> memoryTier;
+    std::unique_ptr<CompilerCacheAsyncWriter> asyncWriter;
 };
 } // namespace NEO
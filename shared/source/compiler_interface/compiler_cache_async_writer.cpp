@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_async_writer.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+CompilerCacheAsyncWriter::CompilerCacheAsyncWriter(CompilerCache &compilerCache, size_t maxQueuedSize) : compilerCache(compilerCache), maxQueuedSize(maxQueuedSize) {
+    worker = Thread::createFunc(run, reinterpret_cast<void *>(this));
+}
+
+CompilerCacheAsyncWriter::~CompilerCacheAsyncWriter() {
+    stop();
+}
+
+bool CompilerCacheAsyncWriter::enqueue(const std::string &kernelFileHash, const CachedBinaryView &binary) {
+    if (binary == nullptr || binary->size == 0u) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (pending.find(kernelFileHash) != pending.end()) {
+        return true;
+    }
+
+    if (worker != nullptr && binary->size <= maxQueuedSize) {
+        workDone.wait(lock, [&]() { return !active || queuedSize + binary->size <= maxQueuedSize; });
+    }
+
+    if (worker == nullptr || !active || binary->size > maxQueuedSize) {
+        lock.unlock();
+        return compilerCache.cacheBinary(kernelFileHash, binary->data.get(), binary->size);
+    }
+
+    queue.emplace_back(kernelFileHash, binary);
+    pending.emplace(kernelFileHash, binary);
+    queuedSize += binary->size;
+    lock.unlock();
+    workAvailable.notify_one();
+    return true;
+}
+
+CachedBinaryView CompilerCacheAsyncWriter::findPending(const std::string &kernelFileHash) const {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    auto it = pending.find(kernelFileHash);
+    if (it == pending.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void CompilerCacheAsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    workDone.wait(lock, [&]() { return pending.empty(); });
+}
+
+void CompilerCacheAsyncWriter::stop() {
+    if (worker == nullptr) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    active = false;
+    lock.unlock();
+    workAvailable.notify_all();
+    workDone.notify_all();
+
+    // worker writes all queued binaries before exiting
+    worker->join();
+    worker.reset();
+}
+
+size_t CompilerCacheAsyncWriter::getQueuedSize() const {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return queuedSize;
+}
+
+void CompilerCacheAsyncWriter::writeBatch(const Batch &batch) {
+    for (const auto &[kernelFileHash, binary] : batch) {
+        compilerCache.cacheBinary(kernelFileHash, binary->data.get(), binary->size);
+    }
+}
+
+void *CompilerCacheAsyncWriter::run(void *arg) {
+    auto self = reinterpret_cast<CompilerCacheAsyncWriter *>(arg);
+    Batch batch;
+
+    std::unique_lock<std::mutex> lock(self->queueMutex);
+    while (true) {
+        self->workAvailable.wait(lock, [&]() { return !self->queue.empty() || !self->active; });
+        if (self->queue.empty()) {
+            break;
+        }
+
+        batch.swap(self->queue);
+        lock.unlock();
+
+        self->writeBatch(batch);
+        self->numBatchesWritten++;
+
+        lock.lock();
+        for (const auto &[kernelFileHash, binary] : batch) {
+            self->pending.erase(kernelFileHash);
+            self->queuedSize -= binary->size;
+        }
+        batch.clear();
+        self->workDone.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+#include "shared/source/helpers/constants.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace NEO {
+class CompilerCache;
+class Thread;
+
+// Persists compiler cache binaries on a background thread, so build calls do not wait for file system.
+// Binaries queued while the worker is busy are written as one batch. Queue is bounded by total size
+// of pending binaries - producers block when the limit is reached. All pending binaries are written before destruction.
+class CompilerCacheAsyncWriter {
+  public:
+    static constexpr size_t defaultMaxQueuedSize = 64 * MemoryConstants::megaByte;
+
+    CompilerCacheAsyncWriter(CompilerCache &compilerCache, size_t maxQueuedSize);
+    ~CompilerCacheAsyncWriter();
+
+    CompilerCacheAsyncWriter(const CompilerCacheAsyncWriter &) = delete;
+    CompilerCacheAsyncWriter &operator=(const CompilerCacheAsyncWriter &) = delete;
+
+    bool enqueue(const std::string &kernelFileHash, const CachedBinaryView &binary);
+    CachedBinaryView findPending(const std::string &kernelFileHash) const;
+    void flush();
+    void stop();
+
+    bool isWorkerActive() const {
+        return worker != nullptr;
+    }
+    size_t getQueuedSize() const;
+    uint64_t getNumBatchesWritten() const {
+        return numBatchesWritten.load();
+    }
+
+  protected:
+    using Batch = std::deque<std::pair<std::string, CachedBinaryView>>;
+
+    static void *run(void *arg);
+    void writeBatch(const Batch &batch);
+
+    CompilerCache &compilerCache;
+    const size_t maxQueuedSize;
+    std::unique_ptr<Thread> worker;
+
+    Batch queue;
+    std::unordered_map<std::string, CachedBinaryView> pending;
+    size_t queuedSize = 0u;
+    bool active = true;
+
+    mutable std::mutex queueMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+    std::atomic<uint64_t> numBatchesWritten{0u};
+};
+
+} // namespace NEO
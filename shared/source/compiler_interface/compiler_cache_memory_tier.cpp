@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+
+namespace NEO {
+
+CachedBinaryView CompilerCacheMemoryTier::find(const std::string &kernelFileHash) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(kernelFileHash);
+    if (it == entries.end()) {
+        misses++;
+        return nullptr;
+    }
+
+    lruList.splice(lruList.begin(), lruList, it->second);
+    hits++;
+    return it->second->second;
+}
+
+void CompilerCacheMemoryTier::insert(const std::string &kernelFileHash, const CachedBinaryView &binary) {
+    if (binary == nullptr || binary->size == 0u || binary->size > maxSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(kernelFileHash);
+    if (it != entries.end()) {
+        lruList.splice(lruList.begin(), lruList, it->second);
+        return;
+    }
+
+    evict(binary->size);
+
+    lruList.emplace_front(kernelFileHash, binary);
+    entries[kernelFileHash] = lruList.begin();
+    usedSize += binary->size;
+}
+
+void CompilerCacheMemoryTier::evict(size_t requiredSize) {
+    while (!lruList.empty() && usedSize + requiredSize > maxSize) {
+        auto &leastRecentlyUsed = lruList.back();
+        usedSize -= leastRecentlyUsed.second->size;
+        entries.erase(leastRecentlyUsed.first);
+        lruList.pop_back();
+        evictions++;
+    }
+}
+
+CompilerCacheMemoryTier::Stats CompilerCacheMemoryTier::getStats() const {
+    Stats stats;
+    stats.hits = hits.load();
+    stats.misses = misses.load();
+    stats.evictions = evictions.load();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    stats.usedSize = usedSize;
+    stats.numEntries = entries.size();
+    return stats;
+}
+
+} // namespace NEO
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/arrayref.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+struct CachedBinary {
+    CachedBinary(std::unique_ptr<char[]> &&data, size_t size) : data(std::move(data)), size(size) {}
+
+    ArrayRef<const char> get() const {
+        return ArrayRef<const char>(data.get(), size);
+    }
+
+    const std::unique_ptr<char[]> data;
+    const size_t size;
+};
+
+using CachedBinaryView = std::shared_ptr<const CachedBinary>;
+
+// In-process, size bounded LRU of compiler cache binaries keyed by cached file name.
+// Binaries are immutable and shared, so a hit does not require any copy.
+class CompilerCacheMemoryTier {
+  public:
+    struct Stats {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        size_t usedSize = 0u;
+        size_t numEntries = 0u;
+    };
+
+    CompilerCacheMemoryTier(size_t maxSize) : maxSize(maxSize) {}
+
+    static CachedBinaryView makeView(std::unique_ptr<char[]> &&data, size_t size) {
+        return std::make_shared<const CachedBinary>(std::move(data), size);
+    }
+
+    CachedBinaryView find(const std::string &kernelFileHash);
+    void insert(const std::string &kernelFileHash, const CachedBinaryView &binary);
+
+    Stats getStats() const;
+    size_t getMaxSize() const {
+        return maxSize;
+    }
+
+  protected:
+    using LruList = std::list<std::pair<std::string, CachedBinaryView>>;
+
+    void evict(size_t requiredSize);
+
+    LruList lruList;
+    std::unordered_map<std::string, LruList::iterator> entries;
+    mutable std::mutex mtx;
+    const size_t maxSize;
+    size_t usedSize = 0u;
+
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> evictions{0u};
+};
+
+} // namespace NEO
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/hash.h"
+
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+constexpr size_t minimalDataCapacity = 1024u * 1024u;
+
+size_t getIndexOffset() {
+    return alignUp(sizeof(CompilerCachePack::Header), CompilerCachePack::recordAlignment);
+}
+
+size_t getDataOffset(uint32_t numSets) {
+    return getIndexOffset() + alignUp(static_cast<size_t>(numSets) * CompilerCachePack::waysPerSet * sizeof(CompilerCachePack::IndexEntry), CompilerCachePack::recordAlignment);
+}
+
+uint64_t beginEntryUpdate(CompilerCachePack::IndexEntry &entry) {
+    auto sequence = entry.sequence.load(std::memory_order_relaxed) | 1u;
+    entry.sequence.store(sequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return sequence;
+}
+
+void endEntryUpdate(CompilerCachePack::IndexEntry &entry, uint64_t sequence) {
+    entry.sequence.store(sequence + 1, std::memory_order_release);
+}
+} // namespace
+
+size_t CompilerCachePack::getMinimalPackSize() {
+    return getDataOffset(minNumSets) + minimalDataCapacity;
+}
+
+uint64_t CompilerCachePack::hashKey(const std::string &key) {
+    return Hash::hash(key.c_str(), key.size());
+}
+
+uint32_t CompilerCachePack::getNumSetsForPackSize(size_t packSize) {
+    uint64_t numSets = Math::nextPowerOfTwo(static_cast<uint64_t>(packSize / (waysPerSet * expectedAverageBinarySize)));
+    numSets = std::clamp<uint64_t>(numSets, minNumSets, maxNumSets);
+    return static_cast<uint32_t>(numSets);
+}
+
+bool CompilerCachePack::isHeaderValid(size_t packSize) const {
+    if (header->magic != packMagic || header->version != packVersion || header->packSize != packSize) {
+        return false;
+    }
+    if (!Math::isPow2(header->numSets) || header->numSets < minNumSets || header->numSets > maxNumSets) {
+        return false;
+    }
+    const auto dataOffset = getDataOffset(header->numSets);
+    if (header->dataOffset != dataOffset || dataOffset >= packSize || header->dataCapacity != packSize - dataOffset) {
+        return false;
+    }
+    return header->writeOffset.load() <= header->dataCapacity &&
+           header->usedEnd.load() <= header->dataCapacity &&
+           header->tailOffset.load() <= header->dataCapacity;
+}
+
+void CompilerCachePack::format(size_t packSize) {
+    const auto numSets = getNumSetsForPackSize(packSize);
+    const auto dataOffset = getDataOffset(numSets);
+
+    header->magic = 0u;
+    std::atomic_thread_fence(std::memory_order_release);
+    memset(reinterpret_cast<char *>(header) + getIndexOffset(), 0, dataOffset - getIndexOffset());
+
+    header->version = packVersion;
+    header->numSets = numSets;
+    header->packSize = packSize;
+    header->dataOffset = dataOffset;
+    header->dataCapacity = packSize - dataOffset;
+    header->writeOffset.store(0u);
+    header->tailOffset.store(0u);
+    header->usedEnd.store(0u);
+    header->accessClock.store(0u);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = packMagic;
+}
+
+bool CompilerCachePack::initialize(void *packMemory, size_t packSize) {
+    header = nullptr;
+    entries = nullptr;
+    if (packMemory == nullptr || packSize < getMinimalPackSize() || !isAligned<recordAlignment>(packMemory)) {
+        return false;
+    }
+
+    header = reinterpret_cast<Header *>(packMemory);
+    if (!isHeaderValid(packSize)) {
+        format(packSize);
+    }
+    entries = reinterpret_cast<IndexEntry *>(reinterpret_cast<char *>(packMemory) + getIndexOffset());
+    return true;
+}
+
+CompilerCachePack::IndexEntry *CompilerCachePack::findEntry(uint64_t keyHash, const std::string &key) {
+    auto set = &entries[(keyHash & (header->numSets - 1)) * waysPerSet];
+    for (uint32_t way = 0; way < waysPerSet; way++) {
+        auto &entry = set[way];
+        if ((entry.sequence.load(std::memory_order_acquire) & 1u) == 0 &&
+            entry.size != 0 &&
+            entry.keyHash == keyHash &&
+            strncmp(entry.key, key.c_str(), maxKeyLength) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CompilerCachePack::IndexEntry *CompilerCachePack::selectVictim(uint64_t keyHash) {
+    auto set = &entries[(keyHash & (header->numSets - 1)) * waysPerSet];
+    IndexEntry *victim = &set[0];
+    for (uint32_t way = 0; way < waysPerSet; way++) {
+        auto &entry = set[way];
+        if ((entry.sequence.load(std::memory_order_relaxed) & 1u) != 0 || entry.size == 0) {
+            return &entry;
+        }
+        if (entry.lastAccess.load(std::memory_order_relaxed) < victim->lastAccess.load(std::memory_order_relaxed)) {
+            victim = &entry;
+        }
+    }
+    return victim;
+}
+
+void CompilerCachePack::invalidateEntry(IndexEntry &entry) {
+    auto sequence = beginEntryUpdate(entry);
+    entry.keyHash = 0u;
+    entry.offset = 0u;
+    entry.size = 0u;
+    entry.key[0] = '\0';
+    endEntryUpdate(entry, sequence);
+}
+
+void CompilerCachePack::evictRecordsUntil(uint64_t endOffset) {
+    auto tail = header->tailOffset.load(std::memory_order_relaxed);
+    const auto usedEnd = header->usedEnd.load(std::memory_order_relaxed);
+    const auto numEntries = getNumEntries();
+
+    while (tail < endOffset && tail < usedEnd) {
+        RecordHeader record = {};
+        memcpy(&record, getData() + tail, sizeof(RecordHeader));
+
+        if (record.recordSize == 0u || !isAligned<recordAlignment>(record.recordSize) || record.recordSize > usedEnd - tail) {
+            // corrupted log, drop every entry still pointing into the remaining part of previous cycle
+            for (uint32_t i = 0; i < numEntries; i++) {
+                if (entries[i].size != 0 && entries[i].offset >= tail && entries[i].offset < usedEnd) {
+                    invalidateEntry(entries[i]);
+                }
+            }
+            tail = usedEnd;
+            break;
+        }
+
+        if (record.entryIndex < numEntries) {
+            auto &entry = entries[record.entryIndex];
+            if (entry.size != 0 && entry.offset == tail) {
+                invalidateEntry(entry);
+            }
+        }
+        tail += record.recordSize;
+    }
+    header->tailOffset.store(tail, std::memory_order_relaxed);
+}
+
+uint64_t CompilerCachePack::reserveRecord(uint64_t recordSize) {
+    auto writeOffset = header->writeOffset.load(std::memory_order_relaxed);
+    if (writeOffset + recordSize > header->dataCapacity) {
+        evictRecordsUntil(header->usedEnd.load(std::memory_order_relaxed));
+        header->usedEnd.store(writeOffset, std::memory_order_relaxed);
+        header->tailOffset.store(0u, std::memory_order_relaxed);
+        writeOffset = 0u;
+    }
+    evictRecordsUntil(writeOffset + recordSize);
+    header->writeOffset.store(writeOffset + recordSize, std::memory_order_relaxed);
+    return writeOffset;
+}
+
+bool CompilerCachePack::store(const std::string &key, const char *pBinary, size_t binarySize) {
+    if (!isInitialized() || pBinary == nullptr || binarySize == 0 || key.empty() || key.size() >= maxKeyLength) {
+        return false;
+    }
+
+    const uint64_t recordSize = alignUp(sizeof(RecordHeader) + binarySize, recordAlignment);
+    if (recordSize > header->dataCapacity) {
+        return false;
+    }
+
+    const auto keyHash = hashKey(key);
+    if (auto existingEntry = findEntry(keyHash, key)) {
+        existingEntry->lastAccess.store(header->accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    auto entry = selectVictim(keyHash);
+    if (entry->size != 0) {
+        invalidateEntry(*entry);
+    }
+
+    const auto offset = reserveRecord(recordSize);
+
+    RecordHeader record = {};
+    record.keyHash = keyHash;
+    record.entryIndex = static_cast<uint32_t>(entry - entries);
+    record.size = binarySize;
+    record.recordSize = recordSize;
+    memcpy(getData() + offset, &record, sizeof(RecordHeader));
+    memcpy(getData() + offset + sizeof(RecordHeader), pBinary, binarySize);
+
+    auto sequence = beginEntryUpdate(*entry);
+    entry->keyHash = keyHash;
+    entry->offset = offset;
+    entry->size = binarySize;
+    memcpy(entry->key, key.c_str(), key.size() + 1);
+    entry->lastAccess.store(header->accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+    endEntryUpdate(*entry, sequence);
+
+    return true;
+}
+
+std::unique_ptr<char[]> CompilerCachePack::load(const std::string &key, size_t &binarySize) const {
+    binarySize = 0u;
+    if (!isInitialized() || key.empty() || key.size() >= maxKeyLength) {
+        return nullptr;
+    }
+
+    const auto keyHash = hashKey(key);
+    auto set = &entries[(keyHash & (header->numSets - 1)) * waysPerSet];
+    for (uint32_t way = 0; way < waysPerSet; way++) {
+        auto &entry = set[way];
+        const auto sequence = entry.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1u) != 0 || entry.size == 0 || entry.keyHash != keyHash ||
+            strncmp(entry.key, key.c_str(), maxKeyLength) != 0) {
+            continue;
+        }
+
+        const auto offset = entry.offset;
+        const auto size = entry.size;
+        if (offset + sizeof(RecordHeader) + size > header->dataCapacity) {
+            return nullptr;
+        }
+
+        auto binary = std::make_unique<char[]>(size);
+        memcpy(binary.get(), getData() + offset + sizeof(RecordHeader), size);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) != sequence) {
+            // entry was evicted while copying
+            return nullptr;
+        }
+
+        entry.lastAccess.store(header->accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        binarySize = static_cast<size_t>(size);
+        return binary;
+    }
+
+    return nullptr;
+}
+
+} // namespace NEO
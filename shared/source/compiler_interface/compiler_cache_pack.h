@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Indexed compiler cache store living in a single memory region (typically a shared file mapping).
+// Layout: Header | IndexEntry[numSets * waysPerSet] | data log
+// Binaries are appended to the data log, which is reused circularly - the oldest records are evicted
+// when the write cursor wraps around. Each index set keeps LRU metadata, the least recently used way is
+// replaced when the set is full. Lookups are lock-free (per-entry sequence counters), stores must be
+// serialized by the caller.
+class CompilerCachePack {
+  public:
+    static constexpr uint64_t packMagic = 0x4b4341504f43454eull; // "NEOCPACK"
+    static constexpr uint32_t packVersion = 1u;
+    static constexpr uint32_t waysPerSet = 4u;
+    static constexpr size_t maxKeyLength = 64u;
+    static constexpr size_t recordAlignment = 64u;
+    static constexpr size_t expectedAverageBinarySize = 64u * 1024u;
+    static constexpr uint32_t minNumSets = 64u;
+    static constexpr uint32_t maxNumSets = 1u << 20;
+
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t numSets;
+        uint64_t packSize;
+        uint64_t dataOffset;
+        uint64_t dataCapacity;
+        std::atomic<uint64_t> writeOffset;
+        std::atomic<uint64_t> tailOffset;
+        std::atomic<uint64_t> usedEnd;
+        std::atomic<uint64_t> accessClock;
+    };
+
+    struct IndexEntry {
+        std::atomic<uint64_t> sequence; // odd while entry is being modified
+        std::atomic<uint64_t> lastAccess;
+        uint64_t keyHash;
+        uint64_t offset;
+        uint64_t size;
+        char key[maxKeyLength];
+    };
+
+    struct RecordHeader {
+        uint64_t keyHash;
+        uint32_t entryIndex;
+        uint32_t reserved;
+        uint64_t size;
+        uint64_t recordSize;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "pack file requires address-free atomics");
+
+    static size_t getMinimalPackSize();
+
+    bool initialize(void *packMemory, size_t packSize);
+    bool isInitialized() const { return header != nullptr; }
+
+    bool store(const std::string &key, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &key, size_t &binarySize) const;
+
+    uint32_t getNumEntries() const { return header ? header->numSets * waysPerSet : 0u; }
+    uint64_t getDataCapacity() const { return header ? header->dataCapacity : 0u; }
+
+  protected:
+    static uint64_t hashKey(const std::string &key);
+    static uint32_t getNumSetsForPackSize(size_t packSize);
+
+    bool isHeaderValid(size_t packSize) const;
+    void format(size_t packSize);
+    IndexEntry *findEntry(uint64_t keyHash, const std::string &key);
+    IndexEntry *selectVictim(uint64_t keyHash);
+    void invalidateEntry(IndexEntry &entry);
+    void evictRecordsUntil(uint64_t endOffset);
+    uint64_t reserveRecord(uint64_t recordSize);
+
+    char *getData() const { return reinterpret_cast<char *>(header) + header->dataOffset; }
+
+    Header *header = nullptr;
+    IndexEntry *entries = nullptr;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,6 +58,13 @@ CompilerInterface::CompilerInterface()
 }
 CompilerInterface::~CompilerInterface() = default;
 
+const Hash128::Digest &CompilerInterface::getHwInfoDigest(const Device &device) {
+    std::call_once(hwInfoDigestInitialized, [&]() {
+        hwInfoDigest = CompilerCache::getHwInfoDigest(device.getHardwareInfo());
+    });
+    return hwInfoDigest;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::build(
     const NEO::Device &device,
     const TranslationInput &input,
@@ -86,7 +93,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     std::string kernelFileHash;
     const auto &igc = *getIgc(&device);
     if (cachingMode == CachingMode::Direct) {
-        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
+        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), getHwInfoDigest(device),
                                                   input.src,
                                                   input.apiOptions,
                                                   input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igc.revision, igc.libSize, igc.libMTime);
@@ -146,7 +153,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         const ArrayRef<const char> specIdsRef(idsBuffer->GetMemory<char>(), idsBuffer->GetSize<char>());
         const ArrayRef<const char> specValuesRef(valuesBuffer->GetMemory<char>(), valuesBuffer->GetSize<char>());
         const auto &igc = *getIgc(&device);
-        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), irRef,
+        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), getHwInfoDigest(device), irRef,
                                                   input.apiOptions,
                                                   input.internalOptions, specIdsRef, specValuesRef, igc.revision, igc.libSize, igc.libMTime);
 
@@ -670,7 +677,7 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
     singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(translationOutput.intermediateRepresentation.mem.get()), translationOutput.intermediateRepresentation.size);
 
     if (NEO::isAnyPackedDeviceBinaryFormat(singleDeviceBinary.deviceBinary)) {
-        compilerCache.cacheBinary(kernelFileHash, translationOutput.deviceBinary.mem.get(), translationOutput.deviceBinary.size);
+        storeBinary(compilerCache, kernelFileHash, translationOutput.deviceBinary.mem.get(), translationOutput.deviceBinary.size);
         return;
     }
 
@@ -679,11 +686,36 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
     auto packedBinary = packDeviceBinary<DeviceBinaryFormat::oclElf>(singleDeviceBinary, packErrors, packWarnings);
 
     if (false == packedBinary.empty()) {
-        compilerCache.cacheBinary(kernelFileHash, reinterpret_cast<const char *>(packedBinary.data()), packedBinary.size());
+        storeBinary(compilerCache, kernelFileHash, reinterpret_cast<const char *>(packedBinary.data()), packedBinary.size());
+    }
+}
+
+void CompilerCacheHelper::storeBinary(CompilerCache &compilerCache, const std::string &kernelFileHash, const char *binary, size_t binarySize) {
+    auto memoryTier = compilerCache.getMemoryTier();
+    auto asyncWriter = compilerCache.getAsyncWriter();
+
+    if (memoryTier == nullptr && asyncWriter == nullptr) {
+        compilerCache.cacheBinary(kernelFileHash, binary, binarySize);
+        return;
+    }
+
+    // single immutable copy shared by memory tier and background writer
+    auto cachedBinary = CompilerCacheMemoryTier::makeView(makeCopy<char>(binary, binarySize), binarySize);
+    if (memoryTier) {
+        memoryTier->insert(kernelFileHash, cachedBinary);
+    }
+    if (asyncWriter) {
+        asyncWriter->enqueue(kernelFileHash, cachedBinary);
+    } else {
+        compilerCache.cacheBinary(kernelFileHash, binary, binarySize);
     }
 }
 
 bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device) {
+    if (compilerCache.getMemoryTier() || compilerCache.getAsyncWriter()) {
+        return loadBinaryViewAndSetOutput(compilerCache, kernelFileHash, output, device);
+    }
+
     size_t cacheBinarySize = 0u;
     auto cacheBinary = compilerCache.loadCachedBinary(kernelFileHash, cacheBinarySize);
 
@@ -705,6 +737,42 @@ bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, co
     return false;
 }
 
+bool CompilerCacheHelper::loadBinaryViewAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device) {
+    auto memoryTier = compilerCache.getMemoryTier();
+    auto asyncWriter = compilerCache.getAsyncWriter();
+
+    CachedBinaryView cachedBinary;
+    if (memoryTier) {
+        cachedBinary = memoryTier->find(kernelFileHash);
+    }
+    if (cachedBinary == nullptr && asyncWriter) {
+        // binary may not be persisted yet
+        cachedBinary = asyncWriter->findPending(kernelFileHash);
+    }
+
+    if (cachedBinary == nullptr) {
+        size_t cacheBinarySize = 0u;
+        auto cacheBinary = compilerCache.loadCachedBinary(kernelFileHash, cacheBinarySize);
+        if (cacheBinary == nullptr) {
+            return false;
+        }
+        cachedBinary = CompilerCacheMemoryTier::makeView(std::move(cacheBinary), cacheBinarySize);
+        if (memoryTier) {
+            memoryTier->insert(kernelFileHash, cachedBinary);
+        }
+    }
+
+    ArrayRef<const uint8_t> archive(reinterpret_cast<const uint8_t *>(cachedBinary->data.get()), cachedBinary->size);
+
+    if (isDeviceBinaryFormat<DeviceBinaryFormat::oclElf>(archive)) {
+        return processPackedCacheBinary(archive, output, device);
+    }
+
+    output.deviceBinary.mem = makeCopy<char>(cachedBinary->data.get(), cachedBinary->size);
+    output.deviceBinary.size = cachedBinary->size;
+    return true;
+}
+
 bool CompilerCacheHelper::processPackedCacheBinary(ArrayRef<const uint8_t> archive, TranslationOutput &output, const NEO::Device &device) {
     auto productAbbreviation = NEO::hardwarePrefix[device.getHardwareInfo().platform.eProductFamily];
     NEO::TargetDevice targetDevice = NEO::getTargetDevice(device.getRootDeviceEnvironment());
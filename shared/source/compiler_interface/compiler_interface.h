@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -15,6 +16,7 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
 #include <map>
+#include <mutex>
 #include <unordered_map>
 
 namespace NEO {
@@ -171,6 +173,11 @@ class CompilerInterface {
     }
     std::unique_ptr<CompilerCache> cache;
 
+    // compiler interface serves devices of one root device, so hwInfo part of cache key is computed once
+    const Hash128::Digest &getHwInfoDigest(const Device &device);
+    std::once_flag hwInfoDigestInitialized;
+    Hash128::Digest hwInfoDigest;
+
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using finalizerDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
@@ -247,6 +254,8 @@ class CompilerCacheHelper {
     static bool loadCacheAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device);
 
   protected:
+    static void storeBinary(CompilerCache &compilerCache, const std::string &kernelFileHash, const char *binary, size_t binarySize);
+    static bool loadBinaryViewAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device);
     static bool processPackedCacheBinary(ArrayRef<const uint8_t> archive, TranslationOutput &output, const NEO::Device &device);
 };
 
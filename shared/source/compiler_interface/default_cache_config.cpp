@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,9 @@ namespace NEO {
 const std::string neoCachePersistent = "NEO_CACHE_PERSISTENT";
 const std::string neoCacheMaxSize = "NEO_CACHE_MAX_SIZE";
 const std::string neoCacheDir = "NEO_CACHE_DIR";
+const std::string neoCacheIndexed = "NEO_CACHE_INDEXED";
+const std::string neoCacheMemorySize = "NEO_CACHE_MEMORY_SIZE";
+const std::string neoCacheAsyncWrite = "NEO_CACHE_ASYNC_WRITE";
 
 const int64_t neoCacheMaxSizeDefault = static_cast<int64_t>(MemoryConstants::gigaByte);
 
@@ -54,6 +57,11 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
             ret.cacheSize = std::numeric_limits<size_t>::max();
         }
 
+        ret.useIndexedStore = envReader.getSetting(neoCacheIndexed.c_str(), false);
+        const auto memoryTierSize = envReader.getSetting(neoCacheMemorySize.c_str(), static_cast<int64_t>(0));
+        ret.memoryTierSize = memoryTierSize > 0 ? static_cast<size_t>(memoryTierSize) : 0u;
+        ret.asyncWriteback = envReader.getSetting(neoCacheAsyncWrite.c_str(), false);
+
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "NEO_CACHE_PERSISTENT is enabled. Cache is located in: %s\n\n",
                            ret.cacheDir.c_str());
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 
 #include "RelocationInfo.h"
 
@@ -129,6 +130,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
         relocInfo.symbolName = relocEntryIt->r_symbol;
+        relocInfo.symbolId = getRelocationSymbolId(relocInfo.symbolName);
         relocInfo.relocationSegment = SegmentType::instructions;
         switch (relocEntryIt->r_type) {
         default:
@@ -158,6 +160,7 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::globalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::globalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    this->dataRelocations.back().symbolId = getRelocationSymbolId(relocationInfo.symbolName);
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
@@ -171,10 +174,19 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
 
     relocationInfo.relocationSegment = SegmentType::instructions;
+    relocationInfo.symbolId = getRelocationSymbolId(relocationInfo.symbolName);
 
     outRelocInfo.push_back(std::move(relocationInfo));
 }
 
+LinkerInput::SymbolId LinkerInput::getRelocationSymbolId(const std::string &symbolName) {
+    auto [symbolIdIt, inserted] = relocationSymbolIds.try_emplace(symbolName, static_cast<SymbolId>(relocationSymbolNames.size()));
+    if (inserted) {
+        relocationSymbolNames.push_back(symbolName);
+    }
+    return symbolIdIt->second;
+}
+
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_32> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_32>::RelocationInfo &reloc);
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_64>::RelocationInfo &reloc);
 template <Elf::ElfIdentifierClass numBits>
@@ -294,6 +306,30 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, con
     }
 }
 
+const LinkerInput::RelocationPlan &LinkerInput::getRelocationPlan() const {
+    std::lock_guard<std::mutex> lock(relocationPlanMutex);
+    if (relocationPlan && (relocationPlan->numInputSymbols == symbols.size()) && (relocationPlan->numRelocationSymbols == relocationSymbolNames.size())) {
+        return *relocationPlan;
+    }
+
+    auto plan = std::make_unique<RelocationPlan>();
+    plan->numInputSymbols = symbols.size();
+    plan->numRelocationSymbols = relocationSymbolNames.size();
+    plan->symbols.reserve(relocationSymbolNames.size() + symbols.size());
+    plan->symbols.assign(relocationSymbolNames.size(), nullptr);
+    for (const auto &symbol : symbols) {
+        auto symbolIdIt = relocationSymbolIds.find(symbol.first);
+        if (symbolIdIt != relocationSymbolIds.end()) {
+            plan->symbols[symbolIdIt->second] = &symbol;
+        } else {
+            plan->symbols.push_back(&symbol);
+        }
+    }
+
+    relocationPlan = std::move(plan);
+    return *relocationPlan;
+}
+
 void LinkerInput::parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName) {
     auto extFuncSymIt = std::find_if(extFuncSymbols.begin(), extFuncSymbols.end(), [relocInfo](auto &pair) {
         return pair.first == relocInfo.symbolName;
@@ -343,8 +379,16 @@ LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const Segm
 
 bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings,
                              const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize) {
+    // relocation symbol ids are bound to relocated symbols while relocating, without looking relocation symbols up by name
+    const auto &relocationPlan = data.getRelocationPlan();
     relocatedSymbols.reserve(data.getSymbols().size());
-    for (const auto &[symbolName, symbolInfo] : data.getSymbols()) {
+    relocatedSymbolsById.assign(relocationPlan.numRelocationSymbols, nullptr);
+    for (size_t symbolIdx = 0U; symbolIdx < relocationPlan.symbols.size(); symbolIdx++) {
+        if (nullptr == relocationPlan.symbols[symbolIdx]) {
+            continue;
+        }
+        const auto &[symbolName, symbolInfo] = *relocationPlan.symbols[symbolIdx];
+        uint64_t gpuAddress = 0U;
         if (symbolInfo.segment == SegmentType::instructions && false == symbolInfo.global) {
             if (symbolInfo.instructionSegmentId >= instructionsSegments.size()) {
                 return false;
@@ -353,7 +397,7 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
             if (symbolInfo.offset + symbolInfo.size > segment.segmentSize) {
                 return false;
             }
-            relocatedSymbols[symbolName] = {symbolInfo, segment.gpuAddress + symbolInfo.offset};
+            gpuAddress = segment.gpuAddress + symbolInfo.offset;
         } else {
             const SegmentInfo *seg = nullptr;
             uint64_t offset = symbolInfo.offset;
@@ -387,12 +431,26 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
                 DEBUG_BREAK_IF(true);
                 return false;
             }
-            relocatedSymbols[symbolName] = {symbolInfo, seg->gpuAddress + offset};
+            gpuAddress = seg->gpuAddress + offset;
+        }
+
+        auto &relocatedSymbol = relocatedSymbols[symbolName];
+        relocatedSymbol = {symbolInfo, gpuAddress};
+        if (symbolIdx < relocationPlan.numRelocationSymbols) {
+            relocatedSymbolsById[symbolIdx] = &relocatedSymbol;
         }
     }
     return true;
 }
 
+const Linker::RelocatedSymbol<SymbolInfo> *Linker::findRelocatedSymbol(const RelocationInfo &relocation) const {
+    if (relocation.symbolId < relocatedSymbolsById.size()) {
+        return relocatedSymbolsById[relocation.symbolId];
+    }
+    auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+    return (symbolIt != relocatedSymbols.end()) ? &symbolIt->second : nullptr;
+}
+
 uint32_t addressSizeInBytes(LinkerInput::RelocationInfo::Type relocationtype) {
     return (relocationtype == LinkerInput::RelocationInfo::Type::address) ? sizeof(uintptr_t) : sizeof(uint32_t);
 }
@@ -416,6 +474,7 @@ void Linker::patchAddress(void *relocAddress, const uint64_t value, const Linker
 }
 
 void Linker::removeLocalSymbolsFromRelocatedSymbols() {
+    relocatedSymbolsById.clear();
     auto it = relocatedSymbols.begin();
     while (it != relocatedSymbols.end()) {
         if (false == it->second.symbol.global) {
@@ -433,34 +492,56 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
+    if (nullptr == taskPool) {
+        for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+            StackVec<uint32_t *, 2> implicitArgsRelocationAddresses;
+            patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], outUnresolvedExternals, implicitArgsRelocationAddresses, kernelDescriptors);
+            for (auto implicitArgsRelocationAddress : implicitArgsRelocationAddresses) {
+                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(implicitArgsRelocationAddress);
             }
+        }
+        return;
+    }
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
-                *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
+    // segments are patched independently, results are merged in segments order
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(relocationsPerSegment.size());
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(relocationsPerSegment.size());
+    taskPool->run(relocationsPerSegment.size(), [&](size_t segId) {
+        patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], unresolvedExternalsPerSegment[segId], implicitArgsRelocationAddressesPerSegment[segId], kernelDescriptors);
+    });
+    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), unresolvedExternalsPerSegment[segId].begin(), unresolvedExternalsPerSegment[segId].end());
+        for (auto implicitArgsRelocationAddress : implicitArgsRelocationAddressesPerSegment[segId]) {
+            pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(implicitArgsRelocationAddress);
+        }
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, std::vector<UnresolvedExternal> &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) const {
+    for (const auto &relocation : data.getRelocationsInInstructionSegments()[segId]) {
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
+
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
+            uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
+            *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
+        } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            if (auto relocatedSymbol = findRelocatedSymbol(relocation)) {
+                uint64_t patchValue = relocatedSymbol->gpuAddress + relocation.addend;
                 patchAddress(relocAddress, patchValue, relocation);
             } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
             }
         }
     }
@@ -477,12 +558,12 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     bool isAnyRelocationPerformed = false;
 
     for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-        if (symbolIt == relocatedSymbols.end()) {
+        auto relocatedSymbol = findRelocatedSymbol(relocation);
+        if (nullptr == relocatedSymbol) {
             outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
             continue;
         }
-        uint64_t srcGpuAddressAs64Bit = symbolIt->second.gpuAddress;
+        uint64_t srcGpuAddressAs64Bit = relocatedSymbol->gpuAddress;
 
         ArrayRef<uint8_t> dst{};
         const void *initData = nullptr;
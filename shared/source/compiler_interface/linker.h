@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -23,6 +25,7 @@ struct ExternalFunctionUsageKernel;
 
 class Device;
 class GraphicsAllocation;
+class ParallelTaskPool;
 struct KernelDescriptor;
 struct ProgramInfo;
 
@@ -85,6 +88,9 @@ struct LinkerInput {
     };
     static_assert(sizeof(Traits) == sizeof(Traits::packed), "");
 
+    using SymbolId = uint32_t;
+    static constexpr SymbolId invalidSymbolId = std::numeric_limits<SymbolId>::max();
+
     struct RelocationInfo {
         enum class Type : uint32_t {
             unknown,
@@ -102,6 +108,7 @@ struct LinkerInput {
         SegmentType relocationSegment = SegmentType::unknown;
         std::string relocationSegmentName;
         int64_t addend = 0U;
+        SymbolId symbolId = invalidSymbolId; // index in getRelocationSymbolNames, assigned when relocation is added to LinkerInput
     };
 
     using SectionNameToSegmentIdMap = std::unordered_map<std::string, uint32_t>;
@@ -109,6 +116,16 @@ struct LinkerInput {
     using SymbolMap = std::unordered_map<std::string, SymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
 
+    // Symbols of this input ordered for relocating, built on first link and replayed by every following link of this input.
+    // First getRelocationSymbolNames().size() entries are indexed by relocation SymbolId (nullptr if symbol is not defined
+    // in this input), remaining symbols of this input follow. Symbols are never removed from input, so plan is stale
+    // only when symbols or relocation symbols were added since it was built.
+    struct RelocationPlan {
+        std::vector<const SymbolMap::value_type *> symbols;
+        size_t numRelocationSymbols = 0U;
+        size_t numInputSymbols = 0U;
+    };
+
     virtual ~LinkerInput();
 
     static SegmentType getSegmentForSection(ConstStringRef name);
@@ -175,8 +192,15 @@ struct LinkerInput {
         return extFunDependencies;
     }
 
+    const std::vector<std::string> &getRelocationSymbolNames() const {
+        return relocationSymbolNames;
+    }
+
+    const RelocationPlan &getRelocationPlan() const;
+
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    SymbolId getRelocationSymbolId(const std::string &symbolName);
 
     Traits traits;
     SymbolMap symbols;
@@ -187,6 +211,12 @@ struct LinkerInput {
     std::vector<ExternalFunctionUsageExtFunc> extFunDependencies;
     int32_t exportedFunctionsSegmentId = -1;
     bool valid = true;
+
+    std::unordered_map<std::string, SymbolId> relocationSymbolIds;
+    std::vector<std::string> relocationSymbolNames;
+
+    mutable std::mutex relocationPlanMutex;
+    mutable std::unique_ptr<RelocationPlan> relocationPlan;
 };
 
 struct Linker {
@@ -228,6 +258,10 @@ struct Linker {
         : data(data) {
     }
 
+    Linker(const LinkerInput &data, ParallelTaskPool *taskPool)
+        : data(data), taskPool(taskPool) {
+    }
+
     LinkingStatus link(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo, const SegmentInfo &exportedFunctionsSegInfo,
                        const SegmentInfo &globalStringsSegInfo, GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
                        const PatchableSegments &instructionsSegments, UnresolvedExternals &outUnresolvedExternals, Device *pDevice, const void *constantsInitData,
@@ -247,11 +281,15 @@ struct Linker {
 
   protected:
     const LinkerInput &data;
+    ParallelTaskPool *taskPool = nullptr;
     RelocatedSymbolsMap relocatedSymbols;
+    std::vector<const RelocatedSymbol<SymbolInfo> *> relocatedSymbolsById;
 
     bool relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize);
+    const RelocatedSymbol<SymbolInfo> *findRelocatedSymbol(const RelocationInfo &relocation) const;
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, std::vector<UnresolvedExternal> &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) const;
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
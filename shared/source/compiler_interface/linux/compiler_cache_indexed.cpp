@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/linux/compiler_cache_indexed.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+
+namespace NEO {
+
+CompilerCacheIndexed::CompilerCacheIndexed(const CompilerCacheConfig &config) : CompilerCache(config) {
+    openPack();
+}
+
+CompilerCacheIndexed::~CompilerCacheIndexed() {
+    asyncWriter.reset();
+    closePack();
+}
+
+std::string CompilerCacheIndexed::getPackFilePath() const {
+    // pack file must not match cache file extension, otherwise file-per-binary eviction could remove it
+    std::string packFileName = config.cacheFileExtension;
+    if (!packFileName.empty() && packFileName[0] == '.') {
+        packFileName.erase(0, 1);
+    }
+    return joinPath(config.cacheDir, packFileName + ".pack");
+}
+
+bool CompilerCacheIndexed::openPack() {
+    const auto packFilePath = getPackFilePath();
+    int fd = NEO::SysCalls::openWithMode(packFilePath.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+    if (fd < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+
+    if (NEO::SysCalls::flock(fd, LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(fd);
+        return false;
+    }
+
+    size_t packSize = std::min(config.cacheSize, maxPackSize);
+    struct stat statBuf = {};
+    bool success = NEO::SysCalls::fstat(fd, &statBuf) == 0;
+    if (success && statBuf.st_size > 0) {
+        // keep layout of pack created by other process, even if configured with different cache size
+        packSize = static_cast<size_t>(statBuf.st_size);
+    }
+    success = success && packSize >= CompilerCachePack::getMinimalPackSize();
+    if (success && statBuf.st_size == 0) {
+        success = NEO::SysCalls::ftruncate(fd, static_cast<off_t>(packSize)) == 0;
+    }
+
+    void *mapping = nullptr;
+    if (success) {
+        mapping = NEO::SysCalls::mmap(nullptr, packSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        success = (mapping != MAP_FAILED) && (mapping != nullptr);
+        if (success && !pack.initialize(mapping, packSize)) {
+            NEO::SysCalls::munmap(mapping, packSize);
+            success = false;
+        }
+    }
+
+    NEO::SysCalls::flock(fd, LOCK_UN);
+
+    if (!success) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Mapping pack file failed, using file per binary cache! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(fd);
+        return false;
+    }
+
+    packFd = fd;
+    packMapping = mapping;
+    packMappingSize = packSize;
+    return true;
+}
+
+void CompilerCacheIndexed::closePack() {
+    if (packMapping != nullptr) {
+        NEO::SysCalls::munmap(packMapping, packMappingSize);
+        packMapping = nullptr;
+        packMappingSize = 0u;
+    }
+    if (packFd >= 0) {
+        NEO::SysCalls::close(packFd);
+        packFd = -1;
+    }
+}
+
+bool CompilerCacheIndexed::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (!pack.isInitialized()) {
+        return CompilerCache::cacheBinary(kernelFileHash, pBinary, binarySize);
+    }
+
+    if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(packWriteMtx);
+    if (NEO::SysCalls::flock(packFd, LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+
+    const auto stored = pack.store(kernelFileHash, pBinary, binarySize);
+
+    NEO::SysCalls::flock(packFd, LOCK_UN);
+    return stored;
+}
+
+std::unique_ptr<char[]> CompilerCacheIndexed::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (!pack.isInitialized()) {
+        return CompilerCache::loadCachedBinary(kernelFileHash, cachedBinarySize);
+    }
+
+    return pack.load(kernelFileHash, cachedBinarySize);
+}
+
+} // namespace NEO
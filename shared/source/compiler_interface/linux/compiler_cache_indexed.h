@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+
+#include <mutex>
+#include <string>
+
+namespace NEO {
+
+// Compiler cache backed by a single, shared mmap'd pack file (see CompilerCachePack).
+// Lookups do not take any lock, stores are serialized with an in-process mutex and flock on the pack file.
+// Falls back to the file-per-binary CompilerCache when the pack file cannot be opened or mapped.
+class CompilerCacheIndexed : public CompilerCache {
+  public:
+    static constexpr size_t maxPackSize = 4ull * 1024u * 1024u * 1024u;
+
+    CompilerCacheIndexed(const CompilerCacheConfig &config);
+    ~CompilerCacheIndexed() override;
+
+    bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override;
+    std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) override;
+
+    bool isPackAvailable() const { return pack.isInitialized(); }
+    std::string getPackFilePath() const;
+
+  protected:
+    bool openPack();
+    void closePack();
+
+    std::mutex packWriteMtx;
+    CompilerCachePack pack;
+    void *packMapping = nullptr;
+    size_t packMappingSize = 0u;
+    int packFd = -1;
+};
+
+} // namespace NEO
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_indexed.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
@@ -29,6 +30,13 @@
 #include <vector>
 
 namespace NEO {
+std::unique_ptr<CompilerCache> CompilerCache::create(const CompilerCacheConfig &config) {
+    if (config.enabled && config.useIndexedStore) {
+        return std::make_unique<CompilerCacheIndexed>(config);
+    }
+    return std::make_unique<CompilerCache>(config);
+}
+
 int filterFunction(const struct dirent *file) {
     std::string_view fileName = file->d_name;
     if (fileName.find(".cl_cache") != fileName.npos ||
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,10 @@
 
 namespace NEO {
 
+std::unique_ptr<CompilerCache> CompilerCache::create(const CompilerCacheConfig &config) {
+    return std::make_unique<CompilerCache>(config);
+}
+
 struct ElementsStruct {
     std::string path;
     FILETIME lastAccessTime;
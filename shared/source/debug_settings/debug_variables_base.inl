@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -395,6 +395,26 @@ DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocationsPerCmdQueue, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers for each initialized opencl command queue.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfInternalHeapsToPreallocate, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of internal heaps when initializing csr.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
+DECLARE_DEBUG_VARIABLE(int64_t, EnableSegregatedFitGpuVaHeaps, 0, "0: default (disabled), >0: (bitmask) for given HeapIndex, GPU VA heap allocator keeps free chunks in size-class segregated lists instead of scanning them linearly")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorThreadCacheBatchSize, -1, "-1: default (disabled), 0: disabled, >0: tag allocators keep per-thread caches of tags, refilled from and released to shared pool in batches of given size")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheSize, -1, "-1: default (4), >0: number of entries in per-kernel cache of generated local ids")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferZeInfoKernelsDecoding, -1, "-1: default (disabled), 0: disabled, 1: L0 modules index kernel sections of .ze_info at creation and decode kernel descriptor on first zeKernelCreate, unless module needs all of them (debugger, ISA relocations, kernel dependencies, stateful access check)")
+DECLARE_DEBUG_VARIABLE(int32_t, ModuleInitWorkerThreads, -1, "-1: default (disabled), 0: disabled, >0: number of worker threads patching relocations, staging ISA and initializing kernel immutable data in parallel during module initialization, and decoding kernel descriptors deferred by DeferZeInfoKernelsDecoding when module needs all of them")
+DECLARE_DEBUG_VARIABLE(int32_t, ShareIsaAcrossModules, -1, "-1: default (disabled), 0: disabled, 1: modules with identical ISA not requiring relocations share single, refcounted ISA chunk uploaded once")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIncrementalResidency, -1, "-1: default (disabled), 0: disabled, 1: with vm bind, pass to submission only allocations not made resident since last buffer object unbind")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableVmBindBatching, -1, "-1: default (disabled), 0: disabled, 1: enabled, bind and unbind buffer objects of memory operations with one vm bind ioctl per vm when supported by kernel driver")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerThreadCount, -1, "-1: default (1 thread), >0: number of threads closing buffer objects in gem close worker")
+DECLARE_DEBUG_VARIABLE(bool, PrintGemCloseWorkerStatistics, false, "Print number of closed buffer objects, max queue depth and close latency of gem close worker when it is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptiveIdleMaxTimeout, -1, "-1: default (disabled), >0: stop idle direct submission rings after timeout learned from submission gaps of each engine, value is max timeout in us ring may be kept running")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionTraceEntries, -1, "-1: default (disabled), >0: record last N ring dispatches of each direct submission to binary trace dumped to ulls_trace_<pid>_<root device>_<context>.bin at exit and to ulls_trace_<pid>_<root device>_<context>_gpu_hang.bin when gpu hang is detected")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmPoolThreadCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, serve allocations up to 4KB from usm pool out of per thread slabs without taking pool lock")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyWorkerThreads, -1, "-1: default (disabled), 0: disabled, >0: number of worker threads splitting large cpu copies through locked pointer of immediate command lists")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableNonTemporalCpuCopy, -1, "-1: default (disabled), 0: disabled, 1: enabled, use streaming stores for cpu copies into locked device memory")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCpuCopyChunkSize, -1, "-1: default (512KB), >0: size in bytes of chunks of cpu copy executed in parallel by cpu copy worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandListsExecutionPlan, -1, "-1: default (enabled), 0: disabled, 1: enabled, reuse residency merged across command lists when the same closed command lists are executed again on a command queue")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListDeferredFlushMaxAppends, -1, "-1: default (disabled), 0 or 1: disabled, >1: maximal number of non-blocking appends of immediate command list coalesced into one submission, pending appends are submitted by host synchronization of command list, event or command queue")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListDeferredFlushTimeoutUs, -1, "-1: default (100), >=0: time in microseconds after which deferred appends of immediate command list are submitted together with next append")
+DECLARE_DEBUG_VARIABLE(int32_t, EventPoolAllocationsCacheSize, -1, "-1: default (0), 0: disabled, >0: maximal number of allocations of destroyed event pools kept by driver for reuse by new event pools with the same allocation requirements")
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
 DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use regular flush task, 1: use immediate flush task")
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
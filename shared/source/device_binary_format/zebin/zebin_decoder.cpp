@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -420,13 +420,7 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
         kernelInfo->heapInfo.kernelHeapSize = static_cast<uint32_t>(kernelInstructions.size());
         kernelInfo->heapInfo.kernelUnpaddedSize = static_cast<uint32_t>(kernelInstructions.size());
 
-        auto &kernelSSH = kernelInfo->kernelDescriptor.generatedSsh;
-        kernelInfo->heapInfo.pSsh = kernelSSH.data();
-        kernelInfo->heapInfo.surfaceStateHeapSize = static_cast<uint32_t>(kernelSSH.size());
-
-        auto &kernelDSH = kernelInfo->kernelDescriptor.generatedDsh;
-        kernelInfo->heapInfo.pDsh = kernelDSH.data();
-        kernelInfo->heapInfo.dynamicStateHeapSize = static_cast<uint32_t>(kernelDSH.size());
+        ZeInfo::populateKernelInfoGeneratedHeaps(*kernelInfo);
     }
 
     return DecodeError::success;
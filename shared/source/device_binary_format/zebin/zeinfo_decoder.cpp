@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 
 namespace NEO::Zebin::ZeInfo {
 
@@ -417,6 +418,13 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
 }
 
 DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning) {
+    if (dst.deferKernelsZeInfoDecoding) {
+        ZeInfoKernelsIndex kernelsIndex;
+        if (indexZeInfoKernels(zeInfo, kernelsIndex)) {
+            return decodeZeInfoDeferred(dst, zeInfo, kernelsIndex, outErrReason, outWarning);
+        }
+    }
+
     Yaml::YamlParser yamlParser;
     bool parseSuccess = yamlParser.parse(zeInfo, outErrReason, outWarning);
     if (false == parseSuccess) {
@@ -461,6 +469,271 @@ DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &o
     return DecodeError::success;
 }
 
+namespace {
+ConstStringRef trimZeInfoValue(ConstStringRef value) {
+    size_t begin = 0U;
+    size_t end = value.size();
+    while (begin < end && (value[begin] == ' ' || value[begin] == '\t')) {
+        ++begin;
+    }
+    while (end > begin && (value[end - 1] == ' ' || value[end - 1] == '\t' || value[end - 1] == '\r')) {
+        --end;
+    }
+    if (end - begin >= 2U && (value[begin] == '\'' || value[begin] == '"') && value[end - 1] == value[begin]) {
+        ++begin;
+        --end;
+    }
+    return value.substr(begin, end - begin);
+}
+
+bool readZeInfoKeyLine(ConstStringRef line, size_t keyPos, ConstStringRef key, ConstStringRef &outValue) {
+    if (line.size() <= keyPos + key.size() || ConstStringRef(line.begin() + keyPos, key.size()) != key) {
+        return false;
+    }
+    size_t colonPos = keyPos + key.size();
+    while (colonPos < line.size() && line[colonPos] == ' ') {
+        ++colonPos;
+    }
+    if (colonPos == line.size() || line[colonPos] != ':') {
+        return false;
+    }
+    outValue = trimZeInfoValue(line.substr(colonPos + 1));
+    return true;
+}
+} // namespace
+
+// Scans .ze_info text line by line, without tokenizing, for list items of top-level kernels entry.
+// Only block style emitted by compilers is recognized - on anything else false is returned and caller should decode whole .ze_info.
+bool indexZeInfoKernels(ConstStringRef zeInfo, ZeInfoKernelsIndex &outKernelsIndex) {
+    outKernelsIndex = {};
+    bool kernelsFound = false;
+    bool inKernels = false;
+    size_t itemIndent = 0U;
+    size_t itemKeyIndent = 0U;
+    size_t itemBegin = 0U;
+    ConstStringRef itemName;
+
+    auto closeItem = [&](size_t itemEnd) {
+        if (itemBegin == itemEnd) {
+            return true;
+        }
+        if (itemName.empty()) {
+            return false;
+        }
+        outKernelsIndex.kernels.push_back({itemName, zeInfo.substr(itemBegin, itemEnd - itemBegin)});
+        itemName = {};
+        return true;
+    };
+
+    size_t lineBegin = 0U;
+    while (lineBegin < zeInfo.size()) {
+        size_t lineEnd = lineBegin;
+        while (lineEnd < zeInfo.size() && zeInfo[lineEnd] != '\n') {
+            ++lineEnd;
+        }
+        ConstStringRef line = zeInfo.substr(lineBegin, lineEnd - lineBegin);
+        size_t nextLineBegin = std::min(lineEnd + 1, zeInfo.size());
+
+        size_t indent = 0U;
+        while (indent < line.size() && line[indent] == ' ') {
+            ++indent;
+        }
+        bool isBlankOrComment = (indent == line.size()) || (line[indent] == '#') || (line[indent] == '\r');
+        if (isBlankOrComment) {
+            lineBegin = nextLineBegin;
+            continue;
+        }
+        if (line[indent] == '\t') {
+            return false;
+        }
+
+        if (indent == 0U) {
+            if (inKernels) {
+                if (line[0] == '-' || false == closeItem(lineBegin)) {
+                    return false;
+                }
+                outKernelsIndex.kernelsBlockEnd = lineBegin;
+                inKernels = false;
+            }
+            ConstStringRef kernelsValue;
+            if (readZeInfoKeyLine(line, 0U, Tags::kernels, kernelsValue)) {
+                if (kernelsFound || false == kernelsValue.empty()) {
+                    return false;
+                }
+                kernelsFound = true;
+                inKernels = true;
+                outKernelsIndex.kernelsBlockBegin = lineBegin;
+                itemBegin = nextLineBegin;
+            }
+        } else if (inKernels) {
+            bool isItemStart = (line[indent] == '-') && (indent + 1 == line.size() || line[indent + 1] == ' ');
+            if (itemIndent == 0U) {
+                if (false == isItemStart) {
+                    return false;
+                }
+                itemIndent = indent;
+            }
+
+            size_t keyPos = indent;
+            if (indent == itemIndent) {
+                if (false == isItemStart || false == closeItem(lineBegin)) {
+                    return false;
+                }
+                itemBegin = lineBegin;
+                keyPos = indent + 1;
+                while (keyPos < line.size() && line[keyPos] == ' ') {
+                    ++keyPos;
+                }
+                itemKeyIndent = keyPos;
+            } else if (indent < itemIndent) {
+                return false;
+            }
+
+            if (keyPos == itemKeyIndent) {
+                readZeInfoKeyLine(line, keyPos, Tags::Kernel::name, itemName);
+            }
+        }
+        lineBegin = nextLineBegin;
+    }
+
+    if (inKernels) {
+        if (false == closeItem(zeInfo.size())) {
+            return false;
+        }
+        outKernelsIndex.kernelsBlockEnd = zeInfo.size();
+    }
+    return false == outKernelsIndex.kernels.empty();
+}
+
+DecodeError decodeZeInfoDeferred(ProgramInfo &dst, ConstStringRef zeInfo, const ZeInfoKernelsIndex &kernelsIndex, std::string &outErrReason, std::string &outWarning) {
+    // kernels are decoded separately, so only global scope is parsed here - with empty kernels entry kept to satisfy validation
+    std::string globalScope = zeInfo.substr(static_cast<size_t>(0U), kernelsIndex.kernelsBlockBegin).str();
+    globalScope.append(zeInfo.begin() + kernelsIndex.kernelsBlockEnd, zeInfo.end());
+    if (false == globalScope.empty() && globalScope.back() != '\n') {
+        globalScope.push_back('\n');
+    }
+    globalScope.append(Tags::kernels.str() + ":\n");
+
+    Yaml::YamlParser yamlParser;
+    bool parseSuccess = yamlParser.parse(globalScope, outErrReason, outWarning);
+    if (false == parseSuccess) {
+        return DecodeError::invalidBinary;
+    }
+
+    ZeInfoSections zeInfoSections{};
+    auto extractZeInfoSectionsError = extractZeInfoSections(yamlParser, zeInfoSections, outErrReason, outWarning);
+    if (false == validateZeInfoSectionsCount(zeInfoSections, outErrReason)) {
+        return DecodeError::invalidBinary;
+    }
+    if (DecodeError::success != extractZeInfoSectionsError) {
+        return extractZeInfoSectionsError;
+    }
+
+    Types::Version zeInfoVersion{};
+    auto zeInfoDecodeError = decodeZeInfoVersion(yamlParser, zeInfoSections, outErrReason, outWarning, zeInfoVersion);
+    if (DecodeError::success != zeInfoDecodeError) {
+        return zeInfoDecodeError;
+    }
+
+    zeInfoDecodeError = decodeZeInfoGlobalHostAccessTable(dst, yamlParser, zeInfoSections, outErrReason, outWarning);
+    if (DecodeError::success != zeInfoDecodeError) {
+        return zeInfoDecodeError;
+    }
+
+    zeInfoDecodeError = decodeZeInfoFunctions(dst, yamlParser, zeInfoSections, outErrReason, outWarning);
+    if (DecodeError::success != zeInfoDecodeError) {
+        return zeInfoDecodeError;
+    }
+
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelsIndex.kernels.size());
+    for (const auto &kernelSection : kernelsIndex.kernels) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        kernelInfo->kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::zebin;
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = kernelSection.name.str();
+        kernelInfo->deferredZeInfo.kernelSection = kernelSection.section;
+        kernelInfo->deferredZeInfo.grfSize = dst.grfSize;
+        kernelInfo->deferredZeInfo.minScratchSpaceSize = dst.minScratchSpaceSize;
+        kernelInfo->deferredZeInfo.zeInfoVersionMajor = zeInfoVersion.major;
+        kernelInfo->deferredZeInfo.zeInfoVersionMinor = zeInfoVersion.minor;
+        dst.kernelInfos.push_back(kernelInfo.release());
+    }
+    return DecodeError::success;
+}
+
+DecodeError decodeDeferredZeInfoKernel(KernelInfo &kernelInfo, std::string &outErrReason, std::string &outWarning) {
+    if (false == kernelInfo.isKernelDescriptorDeferred()) {
+        return DecodeError::success;
+    }
+
+    Yaml::YamlParser yamlParser;
+    bool parseSuccess = yamlParser.parse(kernelInfo.deferredZeInfo.kernelSection, outErrReason, outWarning);
+    if (false == parseSuccess) {
+        return DecodeError::invalidBinary;
+    }
+    if (yamlParser.empty() || yamlParser.getRoot()->numChildren != 1U) {
+        outErrReason.append("DeviceBinaryFormat::zebin::.ze_info : Invalid metadata section of kernel " + kernelInfo.kernelDescriptor.kernelMetadata.kernelName + "\n");
+        return DecodeError::invalidBinary;
+    }
+
+    const auto &deferredZeInfo = kernelInfo.deferredZeInfo;
+    Types::Version zeInfoVersion{deferredZeInfo.zeInfoVersionMajor, deferredZeInfo.zeInfoVersionMinor};
+    const auto &kernelNd = *yamlParser.createChildrenRange(*yamlParser.getRoot()).begin();
+    auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo.kernelDescriptor, yamlParser, kernelNd, deferredZeInfo.grfSize, deferredZeInfo.minScratchSpaceSize, outErrReason, outWarning, zeInfoVersion);
+    if (DecodeError::success != zeInfoErr) {
+        return zeInfoErr;
+    }
+
+    if (KernelDescriptor::isBindlessAddressingKernel(kernelInfo.kernelDescriptor)) {
+        kernelInfo.kernelDescriptor.initBindlessOffsetToSurfaceState();
+    }
+    populateKernelInfoGeneratedHeaps(kernelInfo);
+    kernelInfo.deferredZeInfo = {};
+    return DecodeError::success;
+}
+
+DecodeError decodeDeferredZeInfoKernels(const std::vector<KernelInfo *> &kernelInfos, std::string &outErrReason, std::string &outWarning, ParallelTaskPool *taskPool) {
+    if (nullptr == taskPool) {
+        for (auto kernelInfo : kernelInfos) {
+            auto zeInfoErr = decodeDeferredZeInfoKernel(*kernelInfo, outErrReason, outWarning);
+            if (DecodeError::success != zeInfoErr) {
+                return zeInfoErr;
+            }
+        }
+        return DecodeError::success;
+    }
+
+    struct KernelDecodeResult {
+        DecodeError error = DecodeError::success;
+        std::string errReason;
+        std::string warning;
+    };
+    std::vector<KernelDecodeResult> results(kernelInfos.size());
+    taskPool->run(kernelInfos.size(), [&](size_t kernelId) {
+        auto &result = results[kernelId];
+        result.error = decodeDeferredZeInfoKernel(*kernelInfos[kernelId], result.errReason, result.warning);
+    });
+
+    // report in kernels order, same as sequential decoding
+    for (auto &result : results) {
+        outErrReason.append(result.errReason);
+        outWarning.append(result.warning);
+        if (DecodeError::success != result.error) {
+            return result.error;
+        }
+    }
+    return DecodeError::success;
+}
+
+void populateKernelInfoGeneratedHeaps(KernelInfo &kernelInfo) {
+    auto &kernelSSH = kernelInfo.kernelDescriptor.generatedSsh;
+    kernelInfo.heapInfo.pSsh = kernelSSH.data();
+    kernelInfo.heapInfo.surfaceStateHeapSize = static_cast<uint32_t>(kernelSSH.size());
+
+    auto &kernelDSH = kernelInfo.kernelDescriptor.generatedDsh;
+    kernelInfo.heapInfo.pDsh = kernelDSH.data();
+    kernelInfo.heapInfo.dynamicStateHeapSize = static_cast<uint32_t>(kernelDSH.size());
+}
+
 DecodeError decodeZeInfoVersion(Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, Types::Version &srcZeInfoVersion) {
     if (false == zeInfoSections.version.empty()) {
         auto err = readZeInfoVersionFromZeInfo(srcZeInfoVersion, parser, *zeInfoSections.version[0], outErrReason, outWarning);
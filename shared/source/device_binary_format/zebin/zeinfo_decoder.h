@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@ namespace NEO {
 
 struct KernelDescriptor;
 struct KernelInfo;
+class ParallelTaskPool;
 struct ProgramInfo;
 
 namespace Zebin::ZeInfo {
@@ -53,6 +54,23 @@ struct ZeInfoKernelSections {
 
 DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning);
 
+struct ZeInfoKernelSectionRef {
+    ConstStringRef name;
+    ConstStringRef section;
+};
+
+struct ZeInfoKernelsIndex {
+    size_t kernelsBlockBegin = 0U;
+    size_t kernelsBlockEnd = 0U;
+    std::vector<ZeInfoKernelSectionRef> kernels;
+};
+
+bool indexZeInfoKernels(ConstStringRef zeInfo, ZeInfoKernelsIndex &outKernelsIndex);
+DecodeError decodeZeInfoDeferred(ProgramInfo &dst, ConstStringRef zeInfo, const ZeInfoKernelsIndex &kernelsIndex, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeDeferredZeInfoKernel(KernelInfo &kernelInfo, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeDeferredZeInfoKernels(const std::vector<KernelInfo *> &kernelInfos, std::string &outErrReason, std::string &outWarning, ParallelTaskPool *taskPool = nullptr);
+void populateKernelInfoGeneratedHeaps(KernelInfo &kernelInfo);
+
 DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::vector<NEO::KernelInfo *> &kernelInfos, ConstStringRef metadataString, std::string &outErrReason, std::string &outWarning);
 
 DecodeError extractZeInfoKernelSections(const NEO::Yaml::YamlParser &parser, const NEO::Yaml::Node &kernelNd, ZeInfoKernelSections &outZeInfoKernelSections, ConstStringRef context, std::string &outErrReason, std::string &outWarning);
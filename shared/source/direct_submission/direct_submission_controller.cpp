@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 #include "shared/source/os_interface/product_helper.h"
 
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 
 namespace NEO {
@@ -39,6 +40,9 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerIdleDetection.get() != -1) {
         isCsrIdleDetectionEnabled = debugManager.flags.DirectSubmissionControllerIdleDetection.get();
     }
+    if (debugManager.flags.DirectSubmissionControllerAdaptiveIdleMaxTimeout.get() > 0) {
+        adaptiveIdleMaxTimeout = std::chrono::microseconds{debugManager.flags.DirectSubmissionControllerAdaptiveIdleMaxTimeout.get()};
+    }
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -147,6 +151,7 @@ void DirectSubmissionController::checkNewSubmissions() {
         return;
     }
 
+    const auto now = getCpuTimestamp();
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
     bool shouldRecalculateTimeout = false;
     for (auto &directSubmission : this->directSubmissions) {
@@ -162,15 +167,23 @@ void DirectSubmissionController::checkNewSubmissions() {
             if (state.isStopped) {
                 continue;
             }
+            if (state.submissionObserved && now - state.lastSubmissionTimestamp < getIdleTimeout(state)) {
+                continue;
+            }
             auto lock = csr->obtainUniqueOwnership();
             if (!isCsrIdleDetectionEnabled || isDirectSubmissionIdle(csr, lock)) {
                 csr->stopDirectSubmission(false);
                 state.isStopped = true;
+                state.stopCount++;
                 shouldRecalculateTimeout = true;
                 this->lowestThrottleSubmitted = QueueThrottle::HIGH;
             }
             state.taskCount = csr->peekTaskCount();
         } else {
+            if (state.isStopped && state.submissionObserved) {
+                state.restartCount++;
+            }
+            recordSubmission(state, now);
             state.isStopped = false;
             state.taskCount = taskCount;
             if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
@@ -179,7 +192,7 @@ void DirectSubmissionController::checkNewSubmissions() {
             }
         }
     }
-    if (shouldRecalculateTimeout) {
+    if (shouldRecalculateTimeout && this->adaptiveIdleMaxTimeout.count() == 0) {
         this->recalculateTimeout();
     }
 
@@ -243,6 +256,44 @@ void DirectSubmissionController::recalculateTimeout() {
     this->lastTerminateCpuTimestamp = now;
 }
 
+void DirectSubmissionController::recordSubmission(DirectSubmissionState &state, SteadyClock::time_point now) {
+    if (state.submissionObserved) {
+        // moving averages of gap and its deviation, same weights as TCP round trip time estimation
+        const auto gapUs = std::chrono::duration_cast<std::chrono::microseconds>(now - state.lastSubmissionTimestamp).count();
+        const auto errorUs = gapUs - state.averageGapUs;
+        state.averageGapUs += errorUs / 8;
+        state.gapDeviationUs += (std::abs(errorUs) - state.gapDeviationUs) / 4;
+    }
+    state.lastSubmissionTimestamp = now;
+    state.submissionObserved = true;
+}
+
+std::chrono::microseconds DirectSubmissionController::getIdleTimeout(const DirectSubmissionState &state) const {
+    if (this->adaptiveIdleMaxTimeout.count() == 0) {
+        return std::chrono::microseconds{0};
+    }
+    // keep ring running if next submission is expected within budget, otherwise restart is paid anyway so stop early
+    const auto expectedGap = std::chrono::microseconds{state.averageGapUs + 4 * state.gapDeviationUs};
+    if (expectedGap > this->adaptiveIdleMaxTimeout) {
+        return this->timeout;
+    }
+    return std::max(expectedGap, this->timeout);
+}
+
+bool DirectSubmissionController::getIdleStats(CommandStreamReceiver *csr, DirectSubmissionIdleStats &idleStats) {
+    std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    auto it = this->directSubmissions.find(csr);
+    if (it == this->directSubmissions.end()) {
+        return false;
+    }
+    const auto &state = it->second;
+    idleStats.idleTimeout = this->adaptiveIdleMaxTimeout.count() == 0 ? this->timeout : getIdleTimeout(state);
+    idleStats.averageSubmissionGap = std::chrono::microseconds{state.averageGapUs};
+    idleStats.stopCount = state.stopCount;
+    idleStats.restartCount = state.restartCount;
+    return true;
+}
+
 void DirectSubmissionController::enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue) {
     std::lock_guard lock(this->condVarMutex);
     pagingFenceRequests.push({csr, pagingFenceValue});
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,13 @@ struct WaitForPagingFenceRequest {
     uint64_t pagingFenceValue;
 };
 
+struct DirectSubmissionIdleStats {
+    std::chrono::microseconds idleTimeout{0};
+    std::chrono::microseconds averageSubmissionGap{0};
+    uint32_t stopCount = 0u;
+    uint32_t restartCount = 0u;
+};
+
 enum class TimeoutElapsedMode {
     notElapsed,
     bcsOnly,
@@ -66,11 +73,14 @@ class DirectSubmissionController {
     void enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue);
     void drainPagingFenceQueue();
 
+    bool getIdleStats(CommandStreamReceiver *csr, DirectSubmissionIdleStats &idleStats);
+
   protected:
     struct DirectSubmissionState {
         DirectSubmissionState(DirectSubmissionState &&other) {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            copySubmissionGapStats(other);
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -78,6 +88,7 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            copySubmissionGapStats(other);
             return *this;
         }
 
@@ -87,8 +98,24 @@ class DirectSubmissionController {
         DirectSubmissionState(const DirectSubmissionState &other) = delete;
         DirectSubmissionState &operator=(DirectSubmissionState &&other) = delete;
 
+        void copySubmissionGapStats(const DirectSubmissionState &other) {
+            lastSubmissionTimestamp = other.lastSubmissionTimestamp;
+            averageGapUs = other.averageGapUs;
+            gapDeviationUs = other.gapDeviationUs;
+            stopCount = other.stopCount;
+            restartCount = other.restartCount;
+            submissionObserved = other.submissionObserved;
+        }
+
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+
+        SteadyClock::time_point lastSubmissionTimestamp{};
+        int64_t averageGapUs = 0;
+        int64_t gapDeviationUs = 0;
+        uint32_t stopCount = 0u;
+        uint32_t restartCount = 0u;
+        bool submissionObserved = false;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -99,6 +126,8 @@ class DirectSubmissionController {
 
     void adjustTimeout(CommandStreamReceiver *csr);
     void recalculateTimeout();
+    void recordSubmission(DirectSubmissionState &state, SteadyClock::time_point now);
+    std::chrono::microseconds getIdleTimeout(const DirectSubmissionState &state) const;
     void applyTimeoutForAcLineStatusAndThrottle(bool acLineConnected);
     void updateLastSubmittedThrottle(QueueThrottle throttle);
     size_t getTimeoutParamsMapKey(QueueThrottle throttle, bool acLineStatus);
@@ -120,6 +149,7 @@ class DirectSubmissionController {
     SteadyClock::time_point lastTerminateCpuTimestamp{};
     std::chrono::microseconds maxTimeout{defaultTimeout};
     std::chrono::microseconds timeout{defaultTimeout};
+    std::chrono::microseconds adaptiveIdleMaxTimeout{0};
     int32_t timeoutDivisor = 1;
     int32_t bcsTimeoutDivisor = 1;
     std::unordered_map<size_t, TimeoutParams> timeoutParamsMap;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,7 +12,9 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
 #include <memory>
+#include <string>
 
 namespace NEO {
 class MemoryManager;
@@ -56,6 +58,8 @@ inline constexpr bool defaultDisableMonitorFence = true;
 
 struct BatchBuffer;
 class DirectSubmissionDiagnosticsCollector;
+class DirectSubmissionTrace;
+struct DirectSubmissionTraceEntry;
 class FlushStampTracker;
 class GraphicsAllocation;
 struct HardwareInfo;
@@ -104,6 +108,9 @@ class DirectSubmissionHw {
 
     virtual void unblockPagingFenceSemaphore(uint64_t pagingFenceValue){};
 
+    bool dumpTrace() const;
+    bool dumpTraceOnGpuHang();
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -182,6 +189,8 @@ class DirectSubmissionHw {
     size_t getSizeSystemMemoryFenceAddress();
 
     void createDiagnostic();
+    void recordDispatchTrace(DirectSubmissionTraceEntry &traceEntry, uint64_t tagValue, uint16_t flags);
+    std::string getTraceFileName(bool gpuHang) const;
     void initDiagnostic(bool &submitOnInit);
     MOCKABLE_VIRTUAL void performDiagnosticMode();
     void dispatchDiagnosticModeSection();
@@ -210,6 +219,8 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    std::unique_ptr<DirectSubmissionTrace> trace;
+    std::atomic<bool> gpuHangTraceDumped{false};
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/direct_submission/direct_submission_trace.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -30,6 +31,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
@@ -106,6 +108,10 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     createDiagnostic();
     setImmWritePostSyncOffset();
 
+    if (debugManager.flags.DirectSubmissionTraceEntries.get() > 0) {
+        trace = std::make_unique<DirectSubmissionTrace>(static_cast<size_t>(debugManager.flags.DirectSubmissionTraceEntries.get()));
+    }
+
     dcFlushRequired = MemorySynchronizationCommands<GfxFamily>::getDcFlushEnable(true, inputParams.rootDeviceEnvironment);
     auto &gfxCoreHelper = inputParams.rootDeviceEnvironment.getHelper<GfxCoreHelper>();
     relaxedOrderingEnabled = gfxCoreHelper.isRelaxedOrderingSupported();
@@ -325,7 +331,45 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingScheduler
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    dumpTrace();
+}
+
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::dumpTrace() const {
+    if (!trace) {
+        return false;
+    }
+    return trace->dump(getTraceFileName(false));
+}
+
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::dumpTraceOnGpuHang() {
+    // hang is reported by every submission and wait that detects it, only the first report is dumped
+    if (!trace || gpuHangTraceDumped.exchange(true)) {
+        return false;
+    }
+    return trace->dump(getTraceFileName(true));
+}
+
+template <typename GfxFamily, typename Dispatcher>
+std::string DirectSubmissionHw<GfxFamily, Dispatcher>::getTraceFileName(bool gpuHang) const {
+    // gpu hang dump uses its own file, so dump on teardown does not overwrite it
+    return "ulls_trace_" + std::to_string(SysCalls::getProcessId()) + "_" + std::to_string(rootDeviceIndex) + "_" + std::to_string(osContext.getContextId()) +
+           (gpuHang ? "_gpu_hang" : "") + ".bin";
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::recordDispatchTrace(DirectSubmissionTraceEntry &traceEntry, uint64_t tagValue, uint16_t flags) {
+    traceEntry.submitEndNs = DirectSubmissionTrace::getTimestampNs();
+    traceEntry.tagValue = tagValue;
+    traceEntry.flags = static_cast<uint16_t>(traceEntry.flags | flags);
+    trace->record(traceEntry);
+
+    if (flags & DirectSubmissionTraceFlags::gpuHang) {
+        dumpTraceOnGpuHang();
+    }
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -970,6 +1014,11 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
+    DirectSubmissionTraceEntry traceEntry = {};
+    if (this->trace) {
+        traceEntry.dispatchStartNs = DirectSubmissionTrace::getTimestampNs();
+    }
+
     lastSubmittedThrottle = batchBuffer.throttle;
     bool relaxedOrderingSchedulerWillBeNeeded = (this->relaxedOrderingSchedulerRequired || batchBuffer.hasRelaxedOrderingDependencies);
     bool inputRequiredMonitorFence = false;
@@ -1003,6 +1052,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     }
 
     auto needStart = !this->ringStart;
+    auto ringBufferBeforeDispatch = this->ringCommandStream.getGraphicsAllocation();
 
     this->switchRingBuffersNeeded(requiredMinimalSize, batchBuffer.allocationsForResidency);
 
@@ -1022,8 +1072,24 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     cpuCachelineFlush(currentPosition, dispatchSize);
 
+    if (this->trace) {
+        traceEntry.dispatchGpuVa = startVA;
+        traceEntry.dispatchSize = static_cast<uint32_t>(dispatchSize);
+        traceEntry.queueWorkCount = currentQueueWorkCount;
+        traceEntry.pagingFenceValue = static_cast<uint32_t>(batchBuffer.pagingFenceSemInfo.pagingFenceValue);
+        traceEntry.ringBufferIndex = static_cast<uint16_t>(this->currentRingBuffer);
+        traceEntry.flags = static_cast<uint16_t>((needStart ? DirectSubmissionTraceFlags::ringStart : 0u) |
+                                                 (ringBufferBeforeDispatch != this->ringCommandStream.getGraphicsAllocation() ? DirectSubmissionTraceFlags::ringSwitch : 0u) |
+                                                 (dispatchMonitorFence ? DirectSubmissionTraceFlags::monitorFence : 0u) |
+                                                 (relaxedOrderingSchedulerWillBeNeeded ? DirectSubmissionTraceFlags::relaxedOrderingScheduler : 0u) |
+                                                 (batchBuffer.pagingFenceSemInfo.requiresProgrammingSemaphore() ? DirectSubmissionTraceFlags::pagingFenceSemaphore : 0u));
+    }
+
     auto requiresBlockingResidencyHandling = batchBuffer.pagingFenceSemInfo.requiresBlockingResidencyHandling;
     if (!this->submitCommandBufferToGpu(needStart, startVA, requiredMinimalSize, requiresBlockingResidencyHandling)) {
+        if (this->trace) {
+            recordDispatchTrace(traceEntry, 0u, DirectSubmissionTraceFlags::submitFailed);
+        }
         return false;
     }
 
@@ -1033,8 +1099,14 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     uint64_t flushValue = updateTagValue(dispatchMonitorFence);
     if (flushValue == DirectSubmissionHw<GfxFamily, Dispatcher>::updateTagValueFail) {
+        if (this->trace) {
+            recordDispatchTrace(traceEntry, 0u, DirectSubmissionTraceFlags::gpuHang);
+        }
         return false;
     }
+    if (this->trace) {
+        recordDispatchTrace(traceEntry, flushValue, 0u);
+    }
     flushStamp.setStamp(flushValue);
 
     return this->ringStart;
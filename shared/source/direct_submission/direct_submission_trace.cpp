@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_trace.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NEO {
+
+DirectSubmissionTrace::DirectSubmissionTrace(size_t requestedCapacity) {
+    auto capacity = static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(std::max(requestedCapacity, static_cast<size_t>(1u)))));
+    entries = std::make_unique<DirectSubmissionTraceEntry[]>(capacity);
+    capacityMask = capacity - 1;
+}
+
+uint64_t DirectSubmissionTrace::getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+std::vector<DirectSubmissionTraceEntry> DirectSubmissionTrace::snapshot() const {
+    const auto recordedCount = getRecordedCount();
+    const auto firstIndex = recordedCount > getCapacity() ? recordedCount - getCapacity() : 0u;
+
+    std::vector<DirectSubmissionTraceEntry> orderedEntries;
+    orderedEntries.reserve(static_cast<size_t>(recordedCount - firstIndex));
+    for (auto index = firstIndex; index < recordedCount; index++) {
+        orderedEntries.push_back(entries[index & capacityMask]);
+    }
+    return orderedEntries;
+}
+
+bool DirectSubmissionTrace::dump(const std::string &fileName) const {
+    const auto orderedEntries = snapshot();
+
+    DirectSubmissionTraceFileHeader header = {};
+    header.magic = fileMagic;
+    header.version = fileVersion;
+    header.entrySize = static_cast<uint32_t>(sizeof(DirectSubmissionTraceEntry));
+    header.entryCount = static_cast<uint32_t>(orderedEntries.size());
+    header.droppedEntries = getRecordedCount() - orderedEntries.size();
+
+    const auto entriesSize = orderedEntries.size() * sizeof(DirectSubmissionTraceEntry);
+    std::vector<uint8_t> fileData(sizeof(header) + entriesSize);
+    memcpy_s(fileData.data(), sizeof(header), &header, sizeof(header));
+    if (entriesSize > 0) {
+        memcpy_s(fileData.data() + sizeof(header), entriesSize, orderedEntries.data(), entriesSize);
+    }
+
+    auto file = IoFunctions::fopenPtr(fileName.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    auto written = IoFunctions::fwritePtr(fileData.data(), 1u, fileData.size(), file);
+    IoFunctions::fclosePtr(file);
+    return written == fileData.size();
+}
+
+} // namespace NEO
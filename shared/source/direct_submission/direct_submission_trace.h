@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+namespace DirectSubmissionTraceFlags {
+inline constexpr uint16_t ringStart = 1u << 0;
+inline constexpr uint16_t ringSwitch = 1u << 1;
+inline constexpr uint16_t monitorFence = 1u << 2;
+inline constexpr uint16_t relaxedOrderingScheduler = 1u << 3;
+inline constexpr uint16_t pagingFenceSemaphore = 1u << 4;
+inline constexpr uint16_t submitFailed = 1u << 5;
+inline constexpr uint16_t gpuHang = 1u << 6;
+} // namespace DirectSubmissionTraceFlags
+
+#pragma pack(1)
+struct DirectSubmissionTraceEntry {
+    uint64_t dispatchStartNs;
+    uint64_t submitEndNs;
+    uint64_t dispatchGpuVa;
+    uint64_t tagValue;
+    uint32_t dispatchSize;
+    uint32_t queueWorkCount;
+    uint32_t pagingFenceValue;
+    uint16_t ringBufferIndex;
+    uint16_t flags;
+};
+static_assert(48u == sizeof(DirectSubmissionTraceEntry), "Invalid size for DirectSubmissionTraceEntry");
+
+struct DirectSubmissionTraceFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entrySize;
+    uint32_t entryCount;
+    uint64_t droppedEntries;
+};
+static_assert(24u == sizeof(DirectSubmissionTraceFileHeader), "Invalid size for DirectSubmissionTraceFileHeader");
+#pragma pack()
+
+// Binary trace of ring dispatches, overwritten in circular manner.
+// Single producer (dispatching thread holds csr ownership), snapshot can be taken from any thread;
+// entry overwritten during snapshot may be torn, so consistent dump requires producer to be idle or hung.
+// Layout of dumped file is parsed by scripts/direct_submission_trace_replay.py.
+class DirectSubmissionTrace : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t fileMagic = 0x53'4C'4C'55; // "ULLS"
+    static constexpr uint32_t fileVersion = 1u;
+
+    explicit DirectSubmissionTrace(size_t requestedCapacity);
+
+    static uint64_t getTimestampNs();
+
+    void record(const DirectSubmissionTraceEntry &entry) {
+        auto index = writeIndex.load(std::memory_order_relaxed);
+        entries[index & capacityMask] = entry;
+        writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<DirectSubmissionTraceEntry> snapshot() const;
+    bool dump(const std::string &fileName) const;
+
+    size_t getCapacity() const { return capacityMask + 1; }
+    uint64_t getRecordedCount() const { return writeIndex.load(std::memory_order_acquire); }
+
+  protected:
+    std::unique_ptr<DirectSubmissionTraceEntry[]> entries;
+    size_t capacityMask = 0u;
+    std::atomic<uint64_t> writeIndex{0u};
+};
+
+} // namespace NEO
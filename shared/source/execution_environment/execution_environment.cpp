@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
@@ -47,6 +48,8 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    taskPool.reset();
+    cpuCopyTaskPool.reset();
     if (directSubmissionController) {
         directSubmissionController->stopThread();
     }
@@ -143,6 +146,28 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+ParallelTaskPool *ExecutionEnvironment::initializeTaskPool() {
+    std::lock_guard<std::mutex> lockForInit(initializeTaskPoolMutex);
+    auto numWorkers = debugManager.flags.ModuleInitWorkerThreads.get();
+
+    if (numWorkers > 0 && this->taskPool == nullptr) {
+        this->taskPool = std::make_unique<ParallelTaskPool>(static_cast<uint32_t>(numWorkers));
+    }
+
+    return taskPool.get();
+}
+
+ParallelTaskPool *ExecutionEnvironment::initializeCpuCopyTaskPool() {
+    std::lock_guard<std::mutex> lockForInit(initializeCpuCopyTaskPoolMutex);
+    auto numWorkers = debugManager.flags.CpuCopyWorkerThreads.get();
+
+    if (numWorkers > 0 && this->cpuCopyTaskPool == nullptr) {
+        this->cpuCopyTaskPool = std::make_unique<ParallelTaskPool>(static_cast<uint32_t>(numWorkers));
+    }
+
+    return cpuCopyTaskPool.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
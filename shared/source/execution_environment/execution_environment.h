@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@ class DirectSubmissionController;
 class GfxCoreHelper;
 class MemoryManager;
 struct OsEnvironment;
+class ParallelTaskPool;
 struct RootDeviceEnvironment;
 
 class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment> {
@@ -68,9 +69,13 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    ParallelTaskPool *initializeTaskPool();
+    ParallelTaskPool *initializeCpuCopyTaskPool();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<ParallelTaskPool> taskPool;
+    std::unique_ptr<ParallelTaskPool> cpuCopyTaskPool;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -95,6 +100,8 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::mutex initializeTaskPoolMutex;
+    std::mutex initializeCpuCopyTaskPoolMutex;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
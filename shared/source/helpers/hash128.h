@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace NEO {
+
+// Streaming, non-cryptographic 128-bit hash meant for large inputs (e.g. compiler cache keys).
+// Input is consumed in 64-byte stripes by 8 independent 64-bit lanes (xxh3-like accumulate/scramble loop),
+// so the inner loop has no cross-lane dependencies and can be vectorized by the compiler.
+class Hash128 {
+  public:
+    struct Digest {
+        uint64_t low = 0u;
+        uint64_t high = 0u;
+
+        bool operator==(const Digest &rhs) const {
+            return (low == rhs.low) && (high == rhs.high);
+        }
+        bool operator!=(const Digest &rhs) const {
+            return !(*this == rhs);
+        }
+
+        std::string toString() const {
+            constexpr char hexDigits[] = "0123456789abcdef";
+            std::string ret(sizeof(uint64_t) * 4, '0');
+            for (size_t i = 0; i < sizeof(uint64_t) * 2; i++) {
+                const auto shift = (sizeof(uint64_t) * 2 - 1 - i) * 4;
+                ret[i] = hexDigits[(high >> shift) & 0xf];
+                ret[i + sizeof(uint64_t) * 2] = hexDigits[(low >> shift) & 0xf];
+            }
+            return ret;
+        }
+    };
+
+    static constexpr size_t stripeSize = 64u;
+    static constexpr size_t numLanes = stripeSize / sizeof(uint64_t);
+    static constexpr size_t stripesPerBlock = 16u;
+
+    Hash128() {
+        reset();
+    }
+
+    void reset() {
+        acc = {prime32n3, prime64n1, prime64n2, prime64n3, prime64n4, prime32n2, prime64n5, prime32n1};
+        bufferedSize = 0u;
+        totalSize = 0u;
+        stripesInBlock = 0u;
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr || size == 0u) {
+            return;
+        }
+        totalSize += size;
+
+        if (bufferedSize > 0u) {
+            const auto sizeToCopy = std::min(size, stripeSize - bufferedSize);
+            memcpy(buffer + bufferedSize, buff, sizeToCopy);
+            bufferedSize += sizeToCopy;
+            buff += sizeToCopy;
+            size -= sizeToCopy;
+            if (bufferedSize < stripeSize) {
+                return;
+            }
+            consumeStripe(buffer);
+            bufferedSize = 0u;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(buff);
+            buff += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0u) {
+            memcpy(buffer, buff, size);
+            bufferedSize = size;
+        }
+    }
+
+    Digest finish() const {
+        auto finalAcc = acc;
+        if (bufferedSize > 0u) {
+            char lastStripe[stripeSize] = {};
+            memcpy(lastStripe, buffer, bufferedSize);
+            accumulate(finalAcc, lastStripe, stripesInBlock);
+        }
+
+        Digest digest;
+        digest.low = avalanche(totalSize * prime64n1 + mergeAccumulators(finalAcc, 0u));
+        digest.high = avalanche(~(totalSize * prime64n2) + mergeAccumulators(finalAcc, 3u));
+        return digest;
+    }
+
+    static Digest hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    using Accumulators = std::array<uint64_t, numLanes>;
+    using Secret = std::array<uint64_t, numLanes + stripesPerBlock>;
+
+    static constexpr uint64_t prime32n1 = 0x9E3779B1u;
+    static constexpr uint64_t prime32n2 = 0x85EBCA77u;
+    static constexpr uint64_t prime32n3 = 0xC2B2AE3Du;
+    static constexpr uint64_t prime64n1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t prime64n2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t prime64n3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t prime64n4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t prime64n5 = 0x27D4EB2F165667C5ull;
+
+    static constexpr Secret makeSecret() {
+        Secret secret = {};
+        uint64_t state = prime64n5;
+        for (size_t i = 0; i < secret.size(); i++) {
+            state += 0x9E3779B97F4A7C15ull;
+            uint64_t value = state;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+            secret[i] = value ^ (value >> 31);
+        }
+        return secret;
+    }
+
+    static const Secret secret;
+
+    static uint64_t read64(const char *data) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static void accumulate(Accumulators &acc, const char *stripe, size_t stripeIndex) {
+        for (size_t lane = 0; lane < numLanes; lane++) {
+            const uint64_t dataValue = read64(stripe + lane * sizeof(uint64_t));
+            const uint64_t dataKey = dataValue ^ secret[lane + stripeIndex];
+            acc[lane ^ 1] += dataValue;
+            acc[lane] += (dataKey & 0xFFFFFFFFu) * (dataKey >> 32);
+        }
+    }
+
+    static void scramble(Accumulators &acc) {
+        for (size_t lane = 0; lane < numLanes; lane++) {
+            acc[lane] ^= acc[lane] >> 47;
+            acc[lane] ^= secret[stripesPerBlock + lane];
+            acc[lane] *= prime32n1;
+        }
+    }
+
+    static uint64_t multiplyFold64(uint64_t lhs, uint64_t rhs) {
+        const uint64_t loLo = (lhs & 0xFFFFFFFFu) * (rhs & 0xFFFFFFFFu);
+        const uint64_t hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFFu);
+        const uint64_t loHi = (lhs & 0xFFFFFFFFu) * (rhs >> 32);
+        const uint64_t hiHi = (lhs >> 32) * (rhs >> 32);
+        const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFu) + loHi;
+        const uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+        const uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFFu);
+        return lower ^ upper;
+    }
+
+    static uint64_t mergeAccumulators(const Accumulators &acc, size_t secretOffset) {
+        uint64_t result = 0u;
+        for (size_t lane = 0; lane < numLanes; lane += 2) {
+            result += multiplyFold64(acc[lane] ^ secret[secretOffset + lane], acc[lane + 1] ^ secret[secretOffset + lane + 1]);
+        }
+        return result;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 37;
+        value *= 0x165667919E3779F9ull;
+        value ^= value >> 32;
+        return value;
+    }
+
+    void consumeStripe(const char *stripe) {
+        accumulate(acc, stripe, stripesInBlock);
+        if (++stripesInBlock == stripesPerBlock) {
+            scramble(acc);
+            stripesInBlock = 0u;
+        }
+    }
+
+    Accumulators acc;
+    char buffer[stripeSize];
+    size_t bufferedSize;
+    uint64_t totalSize;
+    size_t stripesInBlock;
+};
+
+inline const Hash128::Secret Hash128::secret = Hash128::makeSecret();
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,16 +20,24 @@
 namespace NEO {
 
 LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint32_t grfCount, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
+    : cacheSize(cacheSize), wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
       grfCount(grfCount), grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
+    cache = std::make_unique<LocalIdsCacheEntry[]>(cacheSize);
 }
 
-LocalIdsCache::~LocalIdsCache() {
-    for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
-    }
+LocalIdsCache::~LocalIdsCache() = default;
+
+LocalIdsCache::LocalIdsBuffer::LocalIdsBuffer(size_t sizeAllocated)
+    : data(static_cast<uint8_t *>(alignedMalloc(sizeAllocated, 32))), sizeAllocated(sizeAllocated) {}
+
+LocalIdsCache::LocalIdsBuffer::~LocalIdsBuffer() {
+    alignedFree(data);
+}
+
+LocalIdsCache::LocalIdsBuffer *LocalIdsCache::allocateLocalIdsBuffer(size_t size) {
+    localIdsBuffers.push_back(std::make_unique<LocalIdsBuffer>(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size)))));
+    return localIdsBuffers.back().get();
 }
 
 std::unique_lock<std::mutex> LocalIdsCache::lock() {
@@ -51,38 +59,86 @@ size_t LocalIdsCache::getLocalIdsSizePerThread() const {
 }
 
 void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
-    std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
+    entry.accessCounter.fetch_add(1u, std::memory_order_relaxed);
+    std::memcpy(destination, entry.localIdsBuffer.load(std::memory_order_relaxed)->data, entry.localIdsSize.load(std::memory_order_relaxed));
+}
+
+bool LocalIdsCache::trySetLocalIdsFromCache(uint64_t groupSizeKey, size_t localIdsSize, void *destination) {
+    for (size_t i = 0; i < cacheSize; i++) {
+        auto &cacheEntry = cache[i];
+        const auto sequence = cacheEntry.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1u) || cacheEntry.groupSizeKey.load(std::memory_order_relaxed) != groupSizeKey) {
+            continue;
+        }
+
+        // pointer and size may come from different commits, copy only what requested group needs and what loaded buffer holds
+        const auto localIdsBuffer = cacheEntry.localIdsBuffer.load(std::memory_order_acquire);
+        if (localIdsBuffer == nullptr || localIdsBuffer->sizeAllocated < localIdsSize ||
+            cacheEntry.localIdsSize.load(std::memory_order_relaxed) != localIdsSize) {
+            return false;
+        }
+        std::memcpy(destination, localIdsBuffer->data, localIdsSize);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (cacheEntry.sequence.load(std::memory_order_relaxed) != sequence) {
+            return false;
+        }
+        cacheEntry.accessCounter.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
 }
 
 void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto groupSizeKey = getGroupSizeKey(group);
+    const auto localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
+    if (trySetLocalIdsFromCache(groupSizeKey, localIdsSize, destination)) {
+        hitCount.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+
     auto setLocalIdsLock = lock();
     LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
+    for (size_t i = 0; i < cacheSize; i++) {
+        auto &cacheEntry = cache[i];
+        if (cacheEntry.groupSizeKey.load(std::memory_order_relaxed) == groupSizeKey) {
+            hitCount.fetch_add(1u, std::memory_order_relaxed);
             return setLocalIdsForEntry(cacheEntry, destination);
         }
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
+        if (cacheEntry.accessCounter.load(std::memory_order_relaxed) < leastAccessedEntry->accessCounter.load(std::memory_order_relaxed)) {
             leastAccessedEntry = &cacheEntry;
         }
     }
 
-    commitNewEntry(*leastAccessedEntry, group, rootDeviceEnvironment);
+    const auto misses = missCount.fetch_add(1u, std::memory_order_relaxed) + 1;
+    if (misses % cacheSize == 0) {
+        for (size_t i = 0; i < cacheSize; i++) {
+            cache[i].accessCounter.store(cache[i].accessCounter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+        }
+    }
+    commitNewEntry(*leastAccessedEntry, group, localIdsSize, rootDeviceEnvironment);
     setLocalIdsForEntry(*leastAccessedEntry, destination);
 }
 
-void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    entry.localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
-    if (entry.localIdsSize > entry.localIdsSizeAllocated) {
-        alignedFree(entry.localIdsData);
-        entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
-        entry.localIdsSizeAllocated = entry.localIdsSize;
+void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, size_t localIdsSize, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto sequence = entry.sequence.load(std::memory_order_relaxed);
+    entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto localIdsBuffer = entry.localIdsBuffer.load(std::memory_order_relaxed);
+    if (localIdsBuffer == nullptr || localIdsSize > localIdsBuffer->sizeAllocated) {
+        // lock-free readers may still copy from previous buffer, so it is released with the cache
+        localIdsBuffer = allocateLocalIdsBuffer(localIdsSize);
     }
-    NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
+    NEO::generateLocalIDs(localIdsBuffer->data, static_cast<uint16_t>(simdSize),
                           {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize, grfCount, rootDeviceEnvironment);
+
+    entry.localIdsBuffer.store(localIdsBuffer, std::memory_order_release);
+    entry.localIdsSize.store(localIdsSize, std::memory_order_relaxed);
+    entry.groupSizeKey.store(getGroupSizeKey(group), std::memory_order_relaxed);
+    entry.accessCounter.store(0u, std::memory_order_relaxed);
+    entry.sequence.store(sequence + 2, std::memory_order_release);
 }
 
 } // namespace NEO
\ No newline at end of file
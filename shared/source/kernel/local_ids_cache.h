@@ -1,26 +1,44 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 struct RootDeviceEnvironment;
+
+// Cache of local ids generated for given group sizes.
+// Hits do not take the lock - each entry is guarded by a sequence counter, which is odd while the entry is being
+// rewritten, so a reader that copied data from an entry under modification detects it and retries under the lock.
+// Data buffers are owned by the cache until destruction and never change their size, so a lock-free reader that
+// loaded a buffer and checked it is large enough for the requested group never touches freed or foreign memory.
+// On miss, entry with the lowest access count is replaced; counts are halved every cacheSize misses, so entries
+// that were hot in the past do not stay in cache forever.
 class LocalIdsCache {
   public:
+    struct LocalIdsBuffer {
+        LocalIdsBuffer(size_t sizeAllocated);
+        ~LocalIdsBuffer();
+
+        uint8_t *const data;
+        const size_t sizeAllocated;
+    };
+
     struct LocalIdsCacheEntry {
-        Vec3<uint16_t> groupSize = {0, 0, 0};
-        uint8_t *localIdsData = nullptr;
-        size_t localIdsSize = 0U;
-        size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
+        std::atomic<uint32_t> sequence{0u};
+        std::atomic<uint64_t> groupSizeKey{invalidGroupSizeKey};
+        std::atomic<LocalIdsBuffer *> localIdsBuffer{nullptr};
+        std::atomic<size_t> localIdsSize{0u};
+        std::atomic<size_t> accessCounter{0u};
     };
 
     LocalIdsCache() = delete;
@@ -34,12 +52,29 @@ class LocalIdsCache {
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) const;
     size_t getLocalIdsSizePerThread() const;
 
+    size_t getCacheSize() const { return cacheSize; }
+    uint64_t getHitCount() const { return hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return missCount.load(std::memory_order_relaxed); }
+
+    static constexpr size_t defaultCacheSize = 4u;
+
   protected:
+    static constexpr uint64_t invalidGroupSizeKey = 0u;
+    static uint64_t getGroupSizeKey(const Vec3<uint16_t> &group) {
+        return static_cast<uint64_t>(group[0]) | (static_cast<uint64_t>(group[1]) << 16) | (static_cast<uint64_t>(group[2]) << 32);
+    }
+
+    bool trySetLocalIdsFromCache(uint64_t groupSizeKey, size_t localIdsSize, void *destination);
     void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
-    void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment);
+    void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, size_t localIdsSize, const RootDeviceEnvironment &rootDeviceEnvironment);
+    LocalIdsBuffer *allocateLocalIdsBuffer(size_t size);
     std::unique_lock<std::mutex> lock();
 
-    StackVec<LocalIdsCacheEntry, 4> cache;
+    const size_t cacheSize;
+    std::unique_ptr<LocalIdsCacheEntry[]> cache;
+    std::vector<std::unique_ptr<LocalIdsBuffer>> localIdsBuffers;
+    std::atomic<uint64_t> hitCount{0u};
+    std::atomic<uint64_t> missCount{0u};
     std::mutex setLocalIdsMutex;
     const std::array<uint8_t, 3> wgDimOrder;
     const uint32_t localIdsSizePerThread;
@@ -48,4 +83,4 @@ class LocalIdsCache {
     const uint8_t simdSize;
     const bool usesOnlyImages;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -102,7 +103,7 @@ GfxPartition::~GfxPartition() {
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapExtended);
 }
 
-void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment) {
+void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment, bool segregatedFit) {
     this->base = base;
     this->size = size;
 
@@ -116,19 +117,19 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAli
         size -= 2 * heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment);
+    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment, HeapAllocator::defaultSizeThreshold, segregatedFit);
 }
 
-void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t size) {
+void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t size, bool segregatedFit) {
     this->base = base;
     this->size = size;
 
     size -= GfxPartition::heapGranularity;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u, segregatedFit);
 }
 
-void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize) {
+void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize, bool segregatedFit) {
     this->base = base;
     this->size = size;
 
@@ -136,14 +137,18 @@ void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint6
     size -= GfxPartition::heapGranularity;
     size -= frontWindowSize;
 
-    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize);
+    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize, HeapAllocator::defaultSizeThreshold, segregatedFit);
 }
 
-void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
+void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size, bool segregatedFit) {
     this->base = base;
     this->size = size;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u, segregatedFit);
+}
+
+bool GfxPartition::isSegregatedFitHeap(HeapIndex heapIndex) {
+    return (debugManager.flags.EnableSegregatedFitGpuVaHeaps.get() >> static_cast<uint32_t>(heapIndex)) & 1;
 }
 
 uint64_t GfxPartition::Heap::allocate(size_t &size) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,23 +42,23 @@ class GfxPartition {
     MOCKABLE_VIRTUAL bool init(uint64_t gpuAddressSpace, size_t cpuAddressRangeSizeToReserve, uint32_t rootDeviceIndex, size_t numRootDevices, bool useExternalFrontWindowPool, uint64_t systemMemorySize, uint64_t gfxTop);
 
     void heapInit(HeapIndex heapIndex, uint64_t base, uint64_t size) {
-        getHeap(heapIndex).init(base, size, MemoryConstants::pageSize);
+        getHeap(heapIndex).init(base, size, MemoryConstants::pageSize, isSegregatedFitHeap(heapIndex));
     }
 
     void heapInitWithAllocationAlignment(HeapIndex heapIndex, uint64_t base, uint64_t size, size_t allocationAlignment) {
-        getHeap(heapIndex).init(base, size, allocationAlignment);
+        getHeap(heapIndex).init(base, size, allocationAlignment, isSegregatedFitHeap(heapIndex));
     }
 
     void heapInitExternalWithFrontWindow(HeapIndex heapIndex, uint64_t base, uint64_t size) {
-        getHeap(heapIndex).initExternalWithFrontWindow(base, size);
+        getHeap(heapIndex).initExternalWithFrontWindow(base, size, isSegregatedFitHeap(heapIndex));
     }
 
     void heapInitWithFrontWindow(HeapIndex heapIndex, uint64_t base, uint64_t size, uint64_t frontWindowSize) {
-        getHeap(heapIndex).initWithFrontWindow(base, size, frontWindowSize);
+        getHeap(heapIndex).initWithFrontWindow(base, size, frontWindowSize, isSegregatedFitHeap(heapIndex));
     }
 
     void heapInitFrontWindow(HeapIndex heapIndex, uint64_t base, uint64_t size) {
-        getHeap(heapIndex).initFrontWindow(base, size);
+        getHeap(heapIndex).initFrontWindow(base, size, isSegregatedFitHeap(heapIndex));
     }
 
     MOCKABLE_VIRTUAL uint64_t heapAllocate(HeapIndex heapIndex, size_t &size) {
@@ -95,6 +95,8 @@ class GfxPartition {
         return false;
     }
 
+    static bool isSegregatedFitHeap(HeapIndex heapIndex);
+
     static constexpr uint64_t heapGranularity = MemoryConstants::pageSize64k;
     static constexpr uint64_t heapGranularity2MB = 2 * MemoryConstants::megaByte;
     static constexpr size_t externalFrontWindowPoolSize = 2 * MemoryConstants::pageSize64k;
@@ -109,10 +111,10 @@ class GfxPartition {
     class Heap {
       public:
         Heap() = default;
-        void init(uint64_t base, uint64_t size, size_t allocationAlignment);
-        void initExternalWithFrontWindow(uint64_t base, uint64_t size);
-        void initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize);
-        void initFrontWindow(uint64_t base, uint64_t size);
+        void init(uint64_t base, uint64_t size, size_t allocationAlignment, bool segregatedFit);
+        void initExternalWithFrontWindow(uint64_t base, uint64_t size, bool segregatedFit);
+        void initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize, bool segregatedFit);
+        void initFrontWindow(uint64_t base, uint64_t size, bool segregatedFit);
         uint64_t getBase() const { return base; }
         uint64_t getSize() const { return size; }
         uint64_t getLimit() const { return size ? base + size - 1 : 0; }
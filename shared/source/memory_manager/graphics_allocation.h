@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -182,6 +182,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     TaskCountType getResidencyTaskCount(uint32_t contextId) const { return usageInfos[contextId].residencyTaskCount; }
     void releaseResidencyInOsContext(uint32_t contextId) { updateResidencyTaskCount(objectNotResident, contextId); }
     bool isResidencyTaskCountBelow(TaskCountType taskCount, uint32_t contextId) const { return !isResident(contextId) || getResidencyTaskCount(contextId) < taskCount; }
+    uint32_t getResidencyGeneration(uint32_t contextId) const { return usageInfos[contextId].residencyGeneration; }
+    void setResidencyGeneration(uint32_t newResidencyGeneration, uint32_t contextId) { usageInfos[contextId].residencyGeneration = newResidencyGeneration; }
 
     virtual std::string getAllocationInfoString() const;
     virtual std::string getPatIndexInfoString(const ProductHelper &) const;
@@ -344,6 +346,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         TaskCountType taskCount = objectNotUsed;
         TaskCountType residencyTaskCount = objectNotResident;
         uint32_t inspectionId = 0u;
+        uint32_t residencyGeneration = 0u;
     };
 
     struct SharingInfo {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,16 +44,26 @@ void SVMAllocsManager::MapBasedAllocationTracker::remove(const SvmAllocationData
     allocations.erase(iter);
 }
 
+static_assert(SVMAllocsManager::SvmAllocationCache::numBuckets == Math::log2(static_cast<uint64_t>(SVMAllocsManager::SvmAllocationCache::maxServicedSize)) + 1);
+
+uint32_t SVMAllocsManager::SvmAllocationCache::getBucketIndex(size_t size) {
+    return size == 0u ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
 bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
     if (false == sizeAllowed(size)) {
         return false;
     }
-    std::lock_guard<std::mutex> lock(this->mtx);
-    if (size + this->totalSize > this->maxSize) {
-        return false;
-    }
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
-    this->totalSize += size;
+    auto currentTotalSize = this->totalSize.load();
+    do {
+        if (size + currentTotalSize > this->maxSize) {
+            return false;
+        }
+    } while (!this->totalSize.compare_exchange_weak(currentTotalSize, currentTotalSize + size));
+
+    auto &bucket = this->buckets[getBucketIndex(size)];
+    std::lock_guard<std::mutex> lock(bucket.mtx);
+    bucket.allocations.emplace(std::lower_bound(bucket.allocations.begin(), bucket.allocations.end(), size), size, ptr);
     return true;
 }
 
@@ -69,36 +79,51 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     if (false == sizeAllowed(size)) {
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        if (false == allocUtilizationAllows(size, allocationIter->allocationSize)) {
-            break;
-        }
-        void *allocationPtr = allocationIter->allocation;
-        SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
-        UNRECOVERABLE_IF(!svmAllocData);
-        if (svmAllocData->device == unifiedMemoryProperties.device &&
-            svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
-            totalSize -= allocationIter->allocationSize;
-            allocations.erase(allocationIter);
-            return allocationPtr;
+    // buckets hold increasing sizes, so first matching candidate is smallest one fitting; candidates with other device or flags are skipped one by one
+    for (auto bucketIndex = getBucketIndex(size); bucketIndex < numBuckets; bucketIndex++) {
+        auto &bucket = this->buckets[bucketIndex];
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        for (auto allocationIter = std::lower_bound(bucket.allocations.begin(), bucket.allocations.end(), size);
+             allocationIter != bucket.allocations.end();
+             ++allocationIter) {
+            if (false == allocUtilizationAllows(size, allocationIter->allocationSize)) {
+                return nullptr;
+            }
+            void *allocationPtr = allocationIter->allocation;
+            SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
+            UNRECOVERABLE_IF(!svmAllocData);
+            if (svmAllocData->device == unifiedMemoryProperties.device &&
+                svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
+                svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+                this->totalSize -= allocationIter->allocationSize;
+                bucket.allocations.erase(allocationIter);
+                return allocationPtr;
+            }
         }
     }
     return nullptr;
 }
 
 void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto &cachedAllocationInfo : this->allocations) {
-        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
-        DEBUG_BREAK_IF(nullptr == svmData);
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
+    for (auto &bucket : this->buckets) {
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        for (auto &cachedAllocationInfo : bucket.allocations) {
+            SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+            DEBUG_BREAK_IF(nullptr == svmData);
+            svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
+            this->totalSize -= cachedAllocationInfo.allocationSize;
+        }
+        bucket.allocations.clear();
     }
-    this->allocations.clear();
-    this->totalSize = 0u;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getNumAllocations() {
+    size_t numAllocations = 0u;
+    for (auto &bucket : this->buckets) {
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        numAllocations += bucket.allocations.size();
+    }
+    return numAllocations;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -190,6 +215,9 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
     }
 }
 
+thread_local SVMAllocsManager::SvmAllocLookup SVMAllocsManager::lastSvmAllocLookup;
+std::atomic<uint64_t> SVMAllocsManager::instanceCounter{0u};
+
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport)
     : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport) {
 }
@@ -712,7 +740,6 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
 }
 
 void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
-    this->usmDeviceAllocationsCache.allocations.reserve(128u);
     const auto totalDeviceMemory = device.getGlobalMemorySize(static_cast<uint32_t>(device.getDeviceBitfield().to_ulong()));
     auto ailConfiguration = device.getAilConfigurationHelper();
     const bool limitDeviceMemoryForReuse = ailConfiguration && ailConfiguration->limitAmountOfDeviceMemoryForRecycling();
@@ -724,7 +751,6 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
 }
 
 void SVMAllocsManager::initUsmHostAllocationsCache() {
-    this->usmHostAllocationsCache.allocations.reserve(128u);
     const auto totalSystemMemory = this->memoryManager->getSystemSharedMemory(0u);
     auto fractionOfTotalMemoryForRecycling = 0.02;
     if (debugManager.flags.ExperimentalEnableHostAllocationCache.get() != -1) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,10 +12,12 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/sorted_map.h"
 #include "shared/source/utilities/sorted_vector.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -89,6 +91,7 @@ struct SvmMapOperation {
 class SVMAllocsManager {
   public:
     using SortedVectorBasedAllocationTracker = BaseSortedPointerWithValueVector<SvmAllocationData>;
+    using SortedMapBasedAllocationTracker = BaseSortedPointerWithValueMap<SvmAllocationData>;
 
     class MapBasedAllocationTracker {
         friend class SVMAllocsManager;
@@ -156,21 +159,31 @@ class SVMAllocsManager {
         }
     };
 
+    // Cached allocations are kept in power of two size classes, each sorted by size and guarded by own lock,
+    // so reuse of allocations of different sizes is not serialized. Lookup binary searches a bucket for smallest
+    // fitting size, then scans candidates linearly until one matches device and flags or utilization limit is hit.
     struct SvmAllocationCache {
         static constexpr size_t maxServicedSize = 256 * MemoryConstants::megaByte;
         static constexpr size_t minimalSizeToCheckUtilization = 4 * MemoryConstants::pageSize64k;
         static constexpr double minimalAllocUtilization = 0.5;
+        static constexpr uint32_t numBuckets = 29u;
+
+        struct Bucket {
+            std::vector<SvmCacheAllocationInfo> allocations;
+            std::mutex mtx;
+        };
 
         static bool sizeAllowed(size_t size) { return size <= SvmAllocationCache::maxServicedSize; }
+        static uint32_t getBucketIndex(size_t size);
         bool insert(size_t size, void *);
         static bool allocUtilizationAllows(size_t requestedSize, size_t reuseCandidateSize);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
+        size_t getNumAllocations();
 
-        std::vector<SvmCacheAllocationInfo> allocations;
-        std::mutex mtx;
+        std::array<Bucket, numBuckets> buckets;
         size_t maxSize = 0;
-        size_t totalSize = 0;
+        std::atomic<size_t> totalSize{0u};
     };
 
     enum class FreePolicyType : uint32_t {
@@ -201,8 +214,22 @@ class SVMAllocsManager {
     template <typename T,
               std::enable_if_t<std::is_same_v<T, void> || std::is_same_v<T, const void>, int> = 0>
     SvmAllocationData *getSVMAlloc(T *ptr) {
+        // per thread cache of last hit skips shared lock for repeated lookups of the same allocation, valid until any allocation is removed
+        // other lookups and all writers serialize on mtx
+        auto &lastLookup = lastSvmAllocLookup;
+        if (lastLookup.ownerId == instanceId &&
+            lastLookup.removalEpoch == svmAllocs.getRemovalEpoch() &&
+            SortedMapBasedAllocationTracker::isInRange(ptr, lastLookup.basePtr, lastLookup.size)) {
+            return lastLookup.svmData;
+        }
+
         std::shared_lock<std::shared_mutex> lock(mtx);
-        return svmAllocs.get(ptr);
+        auto it = svmAllocs.getImpl(ptr, true);
+        if (it == svmAllocs.allocations.end()) {
+            return nullptr;
+        }
+        lastLookup = {instanceId, svmAllocs.getRemovalEpoch(), it->first, it->second->size, it->second.get()};
+        return it->second.get();
     }
 
     template <typename T,
@@ -223,7 +250,7 @@ class SVMAllocsManager {
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
     MOCKABLE_VIRTUAL size_t getNumDeferFreeAllocs() const { return svmDeferFreeAllocs.getNumAllocs(); }
-    SortedVectorBasedAllocationTracker *getSVMAllocs() { return &svmAllocs; }
+    SortedMapBasedAllocationTracker *getSVMAllocs() { return &svmAllocs; }
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
@@ -265,7 +292,18 @@ class SVMAllocsManager {
     void insertSVMAlloc(void *ptr, const SvmAllocationData &allocData);
     void makeResidentForAllocationsWithId(uint32_t allocationId, CommandStreamReceiver &csr);
 
-    SortedVectorBasedAllocationTracker svmAllocs;
+    struct SvmAllocLookup {
+        uint64_t ownerId = 0u;
+        uint64_t removalEpoch = 0u;
+        const void *basePtr = nullptr;
+        size_t size = 0u;
+        SvmAllocationData *svmData = nullptr;
+    };
+    static thread_local SvmAllocLookup lastSvmAllocLookup;
+    static std::atomic<uint64_t> instanceCounter;
+    const uint64_t instanceId = ++instanceCounter;
+
+    SortedMapBasedAllocationTracker svmAllocs;
     MapOperationsTracker svmMapOperations;
     MapBasedAllocationTracker svmDeferFreeAllocs;
     MemoryManager *memoryManager;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,11 +9,16 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/thread_cache_registry.h"
+
+#include <algorithm>
 
 namespace NEO {
 
@@ -39,6 +44,17 @@ bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, void *ptr,
     this->poolMemoryType = svmData->memoryType;
     this->minServicedSize = minServicedSize;
     this->maxServicedSize = maxServicedSize;
+
+    this->threadCacheEnabled = debugManager.flags.EnableUsmPoolThreadCache.get() == 1 && minServicedSize <= maxSlabBlockSize;
+    if (this->threadCacheEnabled) {
+        this->poolId = ThreadCacheRegistry::registerOwner();
+        this->slabTableBase = alignDown(castToUint64(this->pool), slabSize);
+        this->slabTableSize = static_cast<size_t>((alignUp(castToUint64(this->poolEnd), slabSize) - this->slabTableBase) / slabSize);
+        this->slabTable = std::make_unique<std::atomic<Slab *>[]>(this->slabTableSize);
+        for (size_t i = 0u; i < this->slabTableSize; i++) {
+            this->slabTable[i].store(nullptr);
+        }
+    }
     return true;
 }
 
@@ -52,6 +68,7 @@ size_t UsmMemAllocPool::getPoolSize() const {
 
 void UsmMemAllocPool::cleanup() {
     if (isInitialized()) {
+        cleanupSlabs();
         this->svmMemoryManager->freeSVMAlloc(this->pool, true);
         this->svmMemoryManager = nullptr;
         this->pool = nullptr;
@@ -97,6 +114,11 @@ void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, const
         if (false == canBePooled(requestedSize, memoryProperties)) {
             return nullptr;
         }
+        if (canUseSlab(requestedSize, memoryProperties.alignment)) {
+            if (void *slabPtr = allocateFromSlab(requestedSize, memoryProperties.alignment)) {
+                return slabPtr;
+            }
+        }
         std::unique_lock<std::mutex> lock(mtx);
         auto actualSize = requestedSize;
         auto pooledAddress = this->chunkAllocator->allocateWithCustomAlignment(actualSize, memoryProperties.alignment);
@@ -117,11 +139,14 @@ bool UsmMemAllocPool::isInPool(const void *ptr) const {
 }
 
 bool UsmMemAllocPool::isEmpty() {
-    return 0u == this->allocations.getNumAllocs();
+    return 0u == this->allocations.getNumAllocs() && 0u == this->slabAllocationsCount.load();
 }
 
 bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
     if (isInitialized() && isInPool(ptr)) {
+        if (freeToSlab(ptr)) {
+            return true;
+        }
         std::unique_lock<std::mutex> lock(mtx);
         auto allocationInfo = allocations.extract(ptr);
         if (allocationInfo) {
@@ -135,6 +160,10 @@ bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
 
 size_t UsmMemAllocPool::getPooledAllocationSize(const void *ptr) {
     if (isInitialized() && isInPool(ptr)) {
+        if (auto slab = getSlab(ptr)) {
+            auto blockIndex = static_cast<uint32_t>((castToUint64(ptr) - slab->address) / slab->blockSize);
+            return slab->allocated[blockIndex].load() ? slab->requestedSizes[blockIndex].load() : 0u;
+        }
         std::unique_lock<std::mutex> lock(mtx);
         auto allocationInfo = allocations.get(ptr);
         if (allocationInfo) {
@@ -146,6 +175,10 @@ size_t UsmMemAllocPool::getPooledAllocationSize(const void *ptr) {
 
 void *UsmMemAllocPool::getPooledAllocationBasePtr(const void *ptr) {
     if (isInitialized() && isInPool(ptr)) {
+        if (auto slab = getSlab(ptr)) {
+            auto blockIndex = static_cast<uint32_t>((castToUint64(ptr) - slab->address) / slab->blockSize);
+            return slab->allocated[blockIndex].load() ? addrToPtr(slab->address + blockIndex * slab->blockSize) : nullptr;
+        }
         std::unique_lock<std::mutex> lock(mtx);
         auto allocationInfo = allocations.get(ptr);
         if (allocationInfo) {
@@ -162,6 +195,208 @@ size_t UsmMemAllocPool::getOffsetInPool(const void *ptr) const {
     return 0u;
 }
 
+bool UsmMemAllocPool::canUseSlab(size_t size, size_t alignment) const {
+    return this->threadCacheEnabled && size <= maxSlabBlockSize && alignment <= maxSlabBlockSize;
+}
+
+UsmMemAllocPool::ThreadCache *UsmMemAllocPool::getThreadCache() {
+    auto threadCache = static_cast<ThreadCache *>(ThreadCacheRegistry::getThreadCache(this->poolId));
+    if (threadCache) {
+        return threadCache;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        auto &threadCacheEntry = this->threadCaches[ThreadCacheRegistry::getThreadToken()];
+        if (!threadCacheEntry) {
+            threadCacheEntry = std::make_unique<ThreadCache>();
+            threadCacheEntry->threadAlive = ThreadCacheRegistry::getThreadAliveFlag();
+        }
+        threadCache = threadCacheEntry.get();
+    }
+    ThreadCacheRegistry::setThreadCache(this->poolId, threadCache);
+    return threadCache;
+}
+
+UsmMemAllocPool::Slab *UsmMemAllocPool::getSlab(const void *ptr) const {
+    if (!this->threadCacheEnabled) {
+        return nullptr;
+    }
+    auto address = castToUint64(ptr);
+    auto slabIndex = static_cast<size_t>((address - this->slabTableBase) / slabSize);
+    if (address < this->slabTableBase || slabIndex >= this->slabTableSize) {
+        return nullptr;
+    }
+    auto slab = this->slabTable[slabIndex].load(std::memory_order_acquire);
+    if (slab == nullptr || address < slab->address || address >= slab->address + slabSize) {
+        return nullptr;
+    }
+    return slab;
+}
+
+UsmMemAllocPool::Slab *UsmMemAllocPool::acquireSlab(uint32_t sizeClass) {
+    std::unique_lock<std::mutex> lock(mtx);
+    size_t size = slabSize;
+    auto slabAddress = this->chunkAllocator->allocateWithCustomAlignment(size, slabSize);
+    if (!slabAddress) {
+        reclaimSlabsOfExitedThreadsLocked();
+        size = slabSize;
+        slabAddress = this->chunkAllocator->allocateWithCustomAlignment(size, slabSize);
+        if (!slabAddress) {
+            return nullptr;
+        }
+    }
+
+    Slab *slab = nullptr;
+    if (this->unusedSlabs.empty()) {
+        this->slabStorage.push_back(std::make_unique<Slab>());
+        slab = this->slabStorage.back().get();
+    } else {
+        slab = this->unusedSlabs.back();
+        this->unusedSlabs.pop_back();
+    }
+
+    slab->address = slabAddress;
+    slab->sizeClass = sizeClass;
+    slab->blockSize = static_cast<size_t>(chunkAlignment) << sizeClass;
+    slab->numBlocks = static_cast<uint32_t>(slabSize / slab->blockSize);
+    slab->ownerThreadToken = ThreadCacheRegistry::getThreadToken();
+    slab->remoteFreeHead.store(Slab::invalidBlock);
+    slab->localFreeBlocks.clear();
+    for (uint32_t blockIndex = 0u; blockIndex < slab->numBlocks; blockIndex++) {
+        slab->localFreeBlocks.push_back(slab->numBlocks - 1 - blockIndex);
+        slab->allocated[blockIndex].store(false);
+        slab->requestedSizes[blockIndex].store(0u);
+    }
+    this->slabTable[(slabAddress - this->slabTableBase) / slabSize].store(slab, std::memory_order_release);
+    return slab;
+}
+
+void UsmMemAllocPool::releaseSlab(ThreadCache &threadCache, Slab *slab) {
+    auto &classSlabs = threadCache.slabs[slab->sizeClass];
+    classSlabs.erase(std::find(classSlabs.begin(), classSlabs.end(), slab));
+
+    std::unique_lock<std::mutex> lock(mtx);
+    releaseSlabLocked(slab);
+}
+
+void UsmMemAllocPool::releaseSlabLocked(Slab *slab) {
+    this->slabTable[(slab->address - this->slabTableBase) / slabSize].store(nullptr, std::memory_order_release);
+    this->chunkAllocator->free(slab->address, slabSize);
+    this->unusedSlabs.push_back(slab);
+}
+
+void UsmMemAllocPool::reclaimSlabsOfExitedThreadsLocked() {
+    auto threadCacheIt = this->threadCaches.begin();
+    while (threadCacheIt != this->threadCaches.end()) {
+        auto &threadCache = *threadCacheIt->second;
+        if (threadCache.threadAlive->load()) {
+            ++threadCacheIt;
+            continue;
+        }
+        bool hasSlabs = false;
+        for (auto &classSlabs : threadCache.slabs) {
+            auto slabIt = classSlabs.begin();
+            while (slabIt != classSlabs.end()) {
+                auto slab = *slabIt;
+                auto blockIndex = slab->remoteFreeHead.exchange(Slab::invalidBlock, std::memory_order_acquire);
+                while (blockIndex != Slab::invalidBlock) {
+                    slab->localFreeBlocks.push_back(blockIndex);
+                    blockIndex = slab->remoteFreeNext[blockIndex].load(std::memory_order_relaxed);
+                }
+                if (slab->localFreeBlocks.size() == slab->numBlocks) {
+                    releaseSlabLocked(slab);
+                    slabIt = classSlabs.erase(slabIt);
+                } else {
+                    ++slabIt;
+                }
+            }
+            hasSlabs |= !classSlabs.empty();
+        }
+        threadCacheIt = hasSlabs ? std::next(threadCacheIt) : this->threadCaches.erase(threadCacheIt);
+    }
+}
+
+void *UsmMemAllocPool::allocateFromSlab(size_t requestedSize, size_t alignment) {
+    auto blockSize = static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(std::max({requestedSize, alignment, static_cast<size_t>(chunkAlignment)}))));
+    auto sizeClass = Math::log2(static_cast<uint64_t>(blockSize / chunkAlignment));
+    auto &classSlabs = getThreadCache()->slabs[sizeClass];
+
+    Slab *slab = nullptr;
+    for (size_t slabIndex = 0u; slabIndex < classSlabs.size(); slabIndex++) {
+        auto candidate = classSlabs[slabIndex];
+        if (candidate->localFreeBlocks.empty()) {
+            auto blockIndex = candidate->remoteFreeHead.exchange(Slab::invalidBlock, std::memory_order_acquire);
+            while (blockIndex != Slab::invalidBlock) {
+                candidate->localFreeBlocks.push_back(blockIndex);
+                blockIndex = candidate->remoteFreeNext[blockIndex].load(std::memory_order_relaxed);
+            }
+        }
+        if (!candidate->localFreeBlocks.empty()) {
+            // keep slab with free blocks first for next allocations
+            std::swap(classSlabs[0], classSlabs[slabIndex]);
+            slab = candidate;
+            break;
+        }
+    }
+    if (slab == nullptr) {
+        slab = acquireSlab(sizeClass);
+        if (slab == nullptr) {
+            return nullptr;
+        }
+        classSlabs.insert(classSlabs.begin(), slab);
+    }
+
+    auto blockIndex = slab->localFreeBlocks.back();
+    slab->localFreeBlocks.pop_back();
+    slab->requestedSizes[blockIndex].store(requestedSize, std::memory_order_relaxed);
+    slab->allocated[blockIndex].store(true, std::memory_order_release);
+    ++this->slabAllocationsCount;
+    ++this->svmMemoryManager->allocationsCounter;
+    return addrToPtr(slab->address + blockIndex * slab->blockSize);
+}
+
+bool UsmMemAllocPool::freeToSlab(const void *ptr) {
+    auto slab = getSlab(ptr);
+    if (slab == nullptr) {
+        return false;
+    }
+    auto offsetInSlab = castToUint64(ptr) - slab->address;
+    auto blockIndex = static_cast<uint32_t>(offsetInSlab / slab->blockSize);
+    if (offsetInSlab % slab->blockSize != 0 || false == slab->allocated[blockIndex].exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+    --this->slabAllocationsCount;
+
+    if (slab->ownerThreadToken != ThreadCacheRegistry::getThreadToken()) {
+        auto head = slab->remoteFreeHead.load(std::memory_order_relaxed);
+        do {
+            slab->remoteFreeNext[blockIndex].store(head, std::memory_order_relaxed);
+        } while (!slab->remoteFreeHead.compare_exchange_weak(head, blockIndex, std::memory_order_release, std::memory_order_relaxed));
+        return true;
+    }
+
+    slab->localFreeBlocks.push_back(blockIndex);
+    auto threadCache = getThreadCache();
+    if (slab->localFreeBlocks.size() == slab->numBlocks && threadCache->slabs[slab->sizeClass].size() > 1u) {
+        releaseSlab(*threadCache, slab);
+    }
+    return true;
+}
+
+void UsmMemAllocPool::cleanupSlabs() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (this->threadCacheEnabled) {
+        ThreadCacheRegistry::unregisterOwner(this->poolId);
+    }
+    this->threadCaches.clear();
+    this->unusedSlabs.clear();
+    this->slabStorage.clear();
+    this->slabTable.reset();
+    this->slabTableSize = 0u;
+    this->slabAllocationsCount = 0u;
+    this->threadCacheEnabled = false;
+}
+
 bool UsmMemAllocPoolsManager::PoolInfo::isPreallocated() const {
     return 0u != preallocateSize;
 }
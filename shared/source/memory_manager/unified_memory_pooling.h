@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,7 +12,11 @@
 #include "shared/source/utilities/sorted_vector.h"
 
 #include <array>
+#include <atomic>
+#include <limits>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class UsmMemAllocPool {
@@ -45,8 +49,44 @@ class UsmMemAllocPool {
     size_t getOffsetInPool(const void *ptr) const;
 
     static constexpr auto chunkAlignment = 512u;
+    static constexpr size_t slabSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t maxSlabBlockSize = 4 * MemoryConstants::kiloByte;
+    static constexpr uint32_t numSlabSizeClasses = 4u;
+    static constexpr uint32_t maxBlocksPerSlab = static_cast<uint32_t>(slabSize / chunkAlignment);
 
   protected:
+    // Slab of equally sized blocks carved from pool and owned by one thread.
+    // Only owner allocates from slab and uses local free list, other threads return blocks through lock-free remote free list.
+    struct Slab {
+        static constexpr uint32_t invalidBlock = std::numeric_limits<uint32_t>::max();
+
+        uint64_t address = 0u;
+        size_t blockSize = 0u;
+        uint32_t numBlocks = 0u;
+        uint32_t sizeClass = 0u;
+        uint64_t ownerThreadToken = 0u;
+        std::vector<uint32_t> localFreeBlocks;
+        std::atomic<uint32_t> remoteFreeHead{invalidBlock};
+        std::array<std::atomic<uint32_t>, maxBlocksPerSlab> remoteFreeNext;
+        std::array<std::atomic<size_t>, maxBlocksPerSlab> requestedSizes;
+        std::array<std::atomic<bool>, maxBlocksPerSlab> allocated;
+    };
+    struct ThreadCache {
+        std::array<std::vector<Slab *>, numSlabSizeClasses> slabs;
+        std::shared_ptr<std::atomic<bool>> threadAlive;
+    };
+
+    bool canUseSlab(size_t size, size_t alignment) const;
+    ThreadCache *getThreadCache();
+    Slab *getSlab(const void *ptr) const;
+    Slab *acquireSlab(uint32_t sizeClass);
+    void releaseSlab(ThreadCache &threadCache, Slab *slab);
+    void releaseSlabLocked(Slab *slab);
+    void reclaimSlabsOfExitedThreadsLocked();
+    void *allocateFromSlab(size_t requestedSize, size_t alignment);
+    bool freeToSlab(const void *ptr);
+    void cleanupSlabs();
+
     size_t poolSize{};
     std::unique_ptr<HeapAllocator> chunkAllocator;
     void *pool{};
@@ -57,6 +97,16 @@ class UsmMemAllocPool {
     InternalMemoryType poolMemoryType;
     size_t minServicedSize;
     size_t maxServicedSize;
+
+    bool threadCacheEnabled = false;
+    uint64_t poolId = 0u;
+    uint64_t slabTableBase = 0u;
+    size_t slabTableSize = 0u;
+    std::unique_ptr<std::atomic<Slab *>[]> slabTable;
+    std::vector<std::unique_ptr<Slab>> slabStorage;
+    std::vector<Slab *> unusedSlabs;
+    std::unordered_map<uint64_t, std::unique_ptr<ThreadCache>> threadCaches;
+    std::atomic<size_t> slabAllocationsCount{0u};
 };
 
 class UsmMemAllocPoolsManager {
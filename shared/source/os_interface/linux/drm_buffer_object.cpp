@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -267,12 +267,7 @@ int BufferObject::bind(OsContext *osContext, uint32_t vmHandleId) {
     auto contextId = getOsContextId(osContext);
     if (!this->bindInfo[contextId][vmHandleId]) {
         retVal = this->drm->bindBufferObject(osContext, vmHandleId, this);
-        if (debugManager.flags.PrintBOBindingResult.get()) {
-            printBOBindingResult(osContext, vmHandleId, true, retVal);
-        }
-        if (!retVal) {
-            this->bindInfo[contextId][vmHandleId] = true;
-        }
+        updateBindInfo(osContext, vmHandleId, true, retVal);
     }
     return retVal;
 }
@@ -282,16 +277,23 @@ int BufferObject::unbind(OsContext *osContext, uint32_t vmHandleId) {
     auto contextId = getOsContextId(osContext);
     if (this->bindInfo[contextId][vmHandleId]) {
         retVal = this->drm->unbindBufferObject(osContext, vmHandleId, this);
-        if (debugManager.flags.PrintBOBindingResult.get()) {
-            printBOBindingResult(osContext, vmHandleId, false, retVal);
-        }
-        if (!retVal) {
-            this->bindInfo[contextId][vmHandleId] = false;
-        }
+        updateBindInfo(osContext, vmHandleId, false, retVal);
     }
     return retVal;
 }
 
+void BufferObject::updateBindInfo(OsContext *osContext, uint32_t vmHandleId, bool bind, int retVal) {
+    if (debugManager.flags.PrintBOBindingResult.get()) {
+        printBOBindingResult(osContext, vmHandleId, bind, retVal);
+    }
+    if (!retVal) {
+        this->bindInfo[getOsContextId(osContext)][vmHandleId] = bind;
+        if (!bind) {
+            this->drm->incrementResidencyGeneration();
+        }
+    }
+}
+
 void BufferObject::printExecutionBuffer(ExecBuffer &execbuf, const size_t &residencyCount, ExecObject *execObjectsStorage, BufferObject *const residency[]) {
     auto ioctlHelper = drm->getIoctlHelper();
     std::stringstream logger;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,16 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
         useNotifyEnableForPostSync = !!(overrideUseNotifyEnableForPostSync);
     }
     kmdWaitTimeout = debugManager.flags.SetKmdWaitTimeout.get();
+
+    // bound allocations stay resident until unbound, so only allocations not bound since last unbind need to be passed on flush
+    // without full range svm residency container is also inspected for allocations requiring L3 flush, so it has to be complete
+    if (debugManager.flags.EnableIncrementalResidency.get() == 1 &&
+        this->drm->isVmBindAvailable() &&
+        rootDeviceEnvironment->isFullRangeSvm() &&
+        this->dispatchMode == DispatchMode::immediateDispatch &&
+        debugManager.flags.MakeEachAllocationResident.get() == -1) {
+        this->residencyGeneration = &this->drm->getResidencyGeneration();
+    }
 }
 
 template <typename GfxFamily>
@@ -131,6 +141,7 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBu
         allocationsForResidency.push_back(batchBuffer.commandBufferAllocation);
     }
 
+    const auto residencyGenerationBeforeMerge = this->residencyGeneration ? this->residencyGeneration->load(std::memory_order_acquire) : 0u;
     MemoryOperationsStatus retVal = memoryOperationsInterface->mergeWithResidencyContainer(this->osContext, allocationsForResidency);
     if (retVal != MemoryOperationsStatus::success) {
         if (retVal == MemoryOperationsStatus::outOfMemory) {
@@ -138,6 +149,9 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBu
         }
         return SubmissionStatus::failed;
     }
+    if (this->residencyGeneration) {
+        this->updateResidencyGeneration(allocationsForResidency, residencyGenerationBeforeMerge);
+    }
 
     if (this->directSubmission.get()) {
         bool ret = this->directSubmission->dispatchCommandBuffer(batchBuffer, *this->flushStamp.get());
@@ -177,6 +191,14 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBu
     return ret;
 }
 
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::updateResidencyGeneration(const ResidencyContainer &mergedAllocations, uint32_t generation) {
+    const auto contextId = this->osContext->getContextId();
+    for (auto &allocation : mergedAllocations) {
+        allocation->setResidencyGeneration(generation, contextId);
+    }
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::readBackAllocation(void *source) {
     reserved = *reinterpret_cast<volatile uint32_t *>(source);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
@@ -15,41 +16,74 @@
 
 #include <atomic>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
-DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
-    thread = Thread::createFunc(worker, reinterpret_cast<void *>(this));
+namespace {
+template <typename T>
+void updateMax(std::atomic<T> &currentMax, T value) {
+    auto observedMax = currentMax.load();
+    while (observedMax < value && !currentMax.compare_exchange_weak(observedMax, value)) {
+    }
 }
-
-void DrmGemCloseWorker::closeThread() {
-    if (thread) {
-        while (!workerDone.load()) {
-            condition.notify_all();
+} // namespace
+
+DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager, uint32_t numWorkers) : memoryManager(memoryManager) {
+    threads.reserve(numWorkers);
+    for (uint32_t i = 0u; i < numWorkers; i++) {
+        auto thread = Thread::createFunc(worker, reinterpret_cast<void *>(this));
+        if (thread == nullptr) {
+            break;
         }
+        threads.push_back(std::move(thread));
+    }
+}
 
+void DrmGemCloseWorker::closeThread() {
+    {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_all();
+    }
+    for (auto &thread : threads) {
         thread->join();
-        thread.reset();
     }
+    threads.clear();
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+    if (debugManager.flags.PrintGemCloseWorkerStatistics.get()) {
+        printStatistics();
+    }
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    auto workItem = new WorkItem{bo, nullptr, std::chrono::steady_clock::now()};
+    updateMax(maxQueueDepth, ++workCount);
+
+    auto currentHead = queueHead.load();
+    do {
+        workItem->next = currentHead;
+    } while (!queueHead.compare_exchange_weak(currentHead, workItem));
+
+    wakeUpWorker();
+}
+
+void DrmGemCloseWorker::wakeUpWorker() {
+    // sleeping workers register under mutex before checking queue, so either they see new item or get notified
+    if (sleepingWorkers.load() > 0u) {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
     active = false;
-    condition.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_all();
+    }
     if (blocking) {
         closeThread();
     }
@@ -59,47 +93,74 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+GemCloseWorkerStatistics DrmGemCloseWorker::getStatistics() const {
+    GemCloseWorkerStatistics statistics;
+    statistics.closedCount = closedCount.load();
+    statistics.totalCloseLatencyNs = totalCloseLatencyNs.load();
+    statistics.maxCloseLatencyNs = maxCloseLatencyNs.load();
+    statistics.maxQueueDepth = maxQueueDepth.load();
+    return statistics;
+}
+
+void DrmGemCloseWorker::printStatistics() const {
+    auto statistics = getStatistics();
+    auto averageCloseLatencyNs = statistics.closedCount ? statistics.totalCloseLatencyNs / statistics.closedCount : 0u;
+    PRINT_DEBUG_STRING(true, stdout, "GEM close worker: closed BOs: %llu, max queue depth: %u, close latency avg: %llu ns, max: %llu ns\n",
+                       static_cast<unsigned long long>(statistics.closedCount), statistics.maxQueueDepth,
+                       static_cast<unsigned long long>(averageCloseLatencyNs), static_cast<unsigned long long>(statistics.maxCloseLatencyNs));
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+inline void DrmGemCloseWorker::processBatch(WorkItem *batch) {
+    // list is in reverse push order
+    WorkItem *orderedBatch = nullptr;
+    while (batch) {
+        auto next = batch->next;
+        batch->next = orderedBatch;
+        orderedBatch = batch;
+        batch = next;
+    }
+
+    while (orderedBatch) {
+        auto workItem = orderedBatch;
+        orderedBatch = orderedBatch->next;
+
+        auto pushTime = workItem->pushTime;
+        close(workItem->bo);
+        delete workItem;
+
+        auto closeLatencyNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - pushTime).count());
+        closedCount++;
+        totalCloseLatencyNs += closeLatencyNs;
+        updateMax(maxCloseLatencyNs, closeLatencyNs);
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
 
-    while (self->active) {
-        lock.lock();
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+    while (true) {
+        auto batch = self->queueHead.exchange(nullptr);
+        if (batch) {
+            self->processBatch(batch);
+            continue;
         }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        if (!self->active) {
+            break;
         }
 
-        lock.unlock();
-        self->processQueue(localQueue);
+        std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+        self->sleepingWorkers++;
+        self->condition.wait(lock, [&]() { return self->queueHead.load() != nullptr || !self->active; });
+        self->sleepingWorkers--;
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
-
-    lock.unlock();
-    self->workerDone.store(true);
+    self->processBatch(self->queueHead.exchange(nullptr));
     return nullptr;
 }
 } // namespace NEO
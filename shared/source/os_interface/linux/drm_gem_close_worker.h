@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,14 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,9 +26,19 @@ enum class GemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct GemCloseWorkerStatistics {
+    uint64_t closedCount = 0u;
+    uint64_t totalCloseLatencyNs = 0u;
+    uint64_t maxCloseLatencyNs = 0u;
+    uint32_t maxQueueDepth = 0u;
+};
+
+// Producers push buffer objects to lock-free list, workers take whole list at once and close it as one batch.
+// Buffer objects are not closed in any particular order.
 class DrmGemCloseWorker {
   public:
-    DrmGemCloseWorker(DrmMemoryManager &memoryManager);
+    DrmGemCloseWorker(DrmMemoryManager &memoryManager) : DrmGemCloseWorker(memoryManager, 1u) {}
+    DrmGemCloseWorker(DrmMemoryManager &memoryManager, uint32_t numWorkers);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
     DrmGemCloseWorker(const DrmGemCloseWorker &) = delete;
@@ -36,23 +48,38 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    GemCloseWorkerStatistics getStatistics() const;
 
   protected:
+    struct WorkItem {
+        BufferObject *bo;
+        WorkItem *next;
+        std::chrono::steady_clock::time_point pushTime;
+    };
+
     void close(BufferObject *workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void wakeUpWorker();
+    void processBatch(WorkItem *batch);
+    void printStatistics() const;
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
-    std::unique_ptr<Thread> thread;
+    std::vector<std::unique_ptr<Thread>> threads;
 
-    std::queue<BufferObject *> queue;
+    std::atomic<WorkItem *> queueHead{nullptr};
     std::atomic<uint32_t> workCount{0};
+    std::atomic<uint32_t> sleepingWorkers{0};
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
-    std::atomic<bool> workerDone{false};
+
+    std::atomic<uint64_t> closedCount{0};
+    std::atomic<uint64_t> totalCloseLatencyNs{0};
+    std::atomic<uint64_t> maxCloseLatencyNs{0};
+    std::atomic<uint32_t> maxQueueDepth{0};
 };
 } // namespace NEO
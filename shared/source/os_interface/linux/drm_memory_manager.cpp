@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -124,7 +124,11 @@ void DrmMemoryManager::initialize(GemCloseWorkerMode mode) {
     }
 
     if (mode != GemCloseWorkerMode::gemCloseWorkerInactive) {
-        gemCloseWorker.reset(new DrmGemCloseWorker(*this));
+        uint32_t gemCloseWorkerThreadCount = 1u;
+        if (debugManager.flags.GemCloseWorkerThreadCount.get() > 0) {
+            gemCloseWorkerThreadCount = static_cast<uint32_t>(debugManager.flags.GemCloseWorkerThreadCount.get());
+        }
+        gemCloseWorker.reset(new DrmGemCloseWorker(*this, gemCloseWorkerThreadCount));
     }
 
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,7 +17,9 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_interface.h"
 
 namespace NEO {
 
@@ -50,6 +52,8 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
     auto deviceBitfield = osContext->getDeviceBitfield();
 
     std::lock_guard<std::mutex> lock(mutex);
+    const bool batchBinds = isVmBindBatchingEnabled();
+    std::vector<BufferObject *> bufferObjectsToBind;
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -67,15 +71,29 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
 
             if (!bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator]) {
                 bo->requireExplicitLockedMemory(drmAllocation->isLockedMemory());
-                int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
+                auto collectedBufferObjects = (batchBinds && !drmAllocation->fragmentsStorage.fragmentCount) ? &bufferObjectsToBind : nullptr;
+                int result = drmAllocation->makeBOsResident(osContext, drmIterator, collectedBufferObjects, true);
                 if (result) {
                     return MemoryOperationsStatus::outOfMemory;
                 }
             }
-            if (!evictable) {
+            if (!evictable && !batchBinds) {
                 drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
             }
         }
+
+        if (!bufferObjectsToBind.empty()) {
+            if (getDrm().bindBufferObjects(osContext, drmIterator, bufferObjectsToBind)) {
+                return MemoryOperationsStatus::outOfMemory;
+            }
+            bufferObjectsToBind.clear();
+        }
+    }
+
+    if (!evictable && batchBinds) {
+        for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+            (*gfxAllocation)->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
+        }
     }
 
     return MemoryOperationsStatus::success;
@@ -118,6 +136,41 @@ int DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAllo
     return 0;
 }
 
+int DrmMemoryOperationsHandlerBind::evictBatchImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, DeviceBitfield deviceBitfield) {
+    std::vector<BufferObject *> bufferObjectsToUnbind;
+    for (auto drmIterator = 0u; drmIterator < deviceBitfield.size(); drmIterator++) {
+        if (!deviceBitfield.test(drmIterator)) {
+            continue;
+        }
+        for (auto &gfxAllocation : gfxAllocations) {
+            auto drmAllocation = static_cast<DrmAllocation *>(gfxAllocation);
+            auto collectedBufferObjects = drmAllocation->fragmentsStorage.fragmentCount ? nullptr : &bufferObjectsToUnbind;
+            int retVal = drmAllocation->makeBOsResident(osContext, drmIterator, collectedBufferObjects, false);
+            if (retVal) {
+                return retVal;
+            }
+        }
+        int retVal = getDrm().unbindBufferObjects(osContext, drmIterator, bufferObjectsToUnbind);
+        if (retVal) {
+            return retVal;
+        }
+        bufferObjectsToUnbind.clear();
+    }
+    for (auto &gfxAllocation : gfxAllocations) {
+        gfxAllocation->updateResidencyTaskCount(GraphicsAllocation::objectNotResident, osContext->getContextId());
+    }
+
+    return 0;
+}
+
+bool DrmMemoryOperationsHandlerBind::isVmBindBatchingEnabled() const {
+    return debugManager.flags.EnableVmBindBatching.get() == 1;
+}
+
+Drm &DrmMemoryOperationsHandlerBind::getDrm() const {
+    return *this->rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>();
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device, GraphicsAllocation &gfxAllocation) {
     std::lock_guard<std::mutex> lock(mutex);
     bool isResident = true;
@@ -216,12 +269,22 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
 
-        for (auto &allocationToEvict : evictCandidates) {
+        if (isVmBindBatchingEnabled()) {
             for (const auto &engine : engines) {
                 if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
                     DeviceBitfield deviceBitfield;
                     deviceBitfield.set(subdeviceIndex);
-                    this->evictImpl(engine.osContext, *allocationToEvict, deviceBitfield);
+                    this->evictBatchImpl(engine.osContext, evictCandidates, deviceBitfield);
+                }
+            }
+        } else {
+            for (auto &allocationToEvict : evictCandidates) {
+                for (const auto &engine : engines) {
+                    if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
+                        DeviceBitfield deviceBitfield;
+                        deviceBitfield.set(subdeviceIndex);
+                        this->evictImpl(engine.osContext, *allocationToEvict, deviceBitfield);
+                    }
                 }
             }
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
 namespace NEO {
+class Drm;
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
@@ -30,6 +31,9 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
+    MOCKABLE_VIRTUAL int evictBatchImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, DeviceBitfield deviceBitfield);
+    bool isVmBindBatchingEnabled() const;
+    Drm &getDrm() const;
     MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
     const RootDeviceEnvironment &rootDeviceEnvironment;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1414,17 +1414,56 @@ void programUserFence(Drm *drm, OsContext *osContext, BufferObject *bo, VmBindEx
     ioctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, address, value, nextExtension);
 }
 
-int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind) {
+uint32_t getVmIdForBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId) {
     auto vmId = drm->getVirtualMemoryAddressSpace(vmHandleId);
-    auto ioctlHelper = drm->getIoctlHelper();
-
-    uint64_t flags = 0u;
 
     if (drm->isPerContextVMRequired()) {
         auto osContextLinux = static_cast<const OsContextLinux *>(osContext);
         UNRECOVERABLE_IF(osContextLinux->getDrmVmIds().size() <= vmHandleId);
         vmId = osContextLinux->getDrmVmIds()[vmHandleId];
     }
+    return vmId;
+}
+
+uint64_t getFlagsForBinding(Drm *drm, BufferObject *bo) {
+    bool bindCapture = bo->isMarkedForCapture();
+    bool bindImmediate = bo->isImmediateBindingRequired();
+    bool bindMakeResident = false;
+    bool readOnlyResource = bo->isReadOnlyGpuResource();
+
+    if (drm->useVMBindImmediate()) {
+        bindMakeResident = bo->isExplicitResidencyRequired();
+        bindImmediate = true;
+    }
+    bool bindLock = bo->isExplicitLockedMemoryRequired();
+    return drm->getIoctlHelper()->getFlagsForVmBind(bindCapture, bindImmediate, bindMakeResident, bindLock, readOnlyResource);
+}
+
+void completePagingFence(Drm *drm, OsContext *osContext, uint32_t vmHandleId, bool bind, bool incrementFenceValue) {
+    auto ioctlHelper = drm->getIoctlHelper();
+    bool waitOnUserFenceAfterBindAndUnbind = false;
+    if (debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get() != -1) {
+        waitOnUserFenceAfterBindAndUnbind = !!debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get();
+    }
+    if (ioctlHelper->isWaitBeforeBindRequired(bind) && waitOnUserFenceAfterBindAndUnbind && drm->useVMBindImmediate()) {
+        auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+        osContextLinux->waitForPagingFence();
+    }
+    if (incrementFenceValue) {
+        if (drm->isPerContextVMRequired()) {
+            auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+            osContextLinux->incFenceVal(vmHandleId);
+        } else {
+            drm->incFenceVal(vmHandleId);
+        }
+    }
+}
+
+int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind) {
+    auto vmId = getVmIdForBinding(drm, osContext, vmHandleId);
+    auto ioctlHelper = drm->getIoctlHelper();
+
+    uint64_t flags = 0u;
 
     std::unique_ptr<uint8_t[]> extensions;
     if (bind) {
@@ -1432,17 +1471,7 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
         if (bo->getBindExtHandles().size() > 0 && allowUUIDsForDebug) {
             extensions = ioctlHelper->prepareVmBindExt(bo->getBindExtHandles());
         }
-        bool bindCapture = bo->isMarkedForCapture();
-        bool bindImmediate = bo->isImmediateBindingRequired();
-        bool bindMakeResident = false;
-        bool readOnlyResource = bo->isReadOnlyGpuResource();
-
-        if (drm->useVMBindImmediate()) {
-            bindMakeResident = bo->isExplicitResidencyRequired();
-            bindImmediate = true;
-        }
-        bool bindLock = bo->isExplicitLockedMemoryRequired();
-        flags |= ioctlHelper->getFlagsForVmBind(bindCapture, bindImmediate, bindMakeResident, bindLock, readOnlyResource);
+        flags |= getFlagsForBinding(drm, bo);
     }
 
     auto &bindAddresses = bo->getColourAddresses();
@@ -1511,25 +1540,71 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
                 break;
             }
         }
-        bool waitOnUserFenceAfterBindAndUnbind = false;
-        if (debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get() != -1) {
-            waitOnUserFenceAfterBindAndUnbind = !!debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get();
-        }
-        if (ioctlHelper->isWaitBeforeBindRequired(bind) && waitOnUserFenceAfterBindAndUnbind && drm->useVMBindImmediate()) {
-            auto osContextLinux = static_cast<OsContextLinux *>(osContext);
-            osContextLinux->waitForPagingFence();
+        completePagingFence(drm, osContext, vmHandleId, bind, incrementFenceValue);
+    }
+
+    return ret;
+}
+
+int changeBufferObjectsBindingBatched(Drm *drm, OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind) {
+    auto vmId = getVmIdForBinding(drm, osContext, vmHandleId);
+    auto ioctlHelper = drm->getIoctlHelper();
+
+    const bool patIndexExtUsed = drm->isVmBindPatIndexProgrammingSupported() && ioctlHelper->isVmBindPatIndexExtSupported();
+    std::unique_ptr<VmBindExtSetPatT[]> vmBindExtSetPats;
+    if (patIndexExtUsed) {
+        vmBindExtSetPats = std::make_unique<VmBindExtSetPatT[]>(bufferObjects.size());
+    }
+
+    std::vector<VmBindParams> vmBinds(bufferObjects.size());
+    for (size_t i = 0; i < bufferObjects.size(); i++) {
+        auto bo = bufferObjects[i];
+        auto &vmBind = vmBinds[i];
+        vmBind.vmId = static_cast<uint32_t>(vmId);
+        vmBind.flags = bind ? getFlagsForBinding(drm, bo) : 0u;
+        vmBind.handle = bind ? bo->peekHandle() : 0u;
+        vmBind.length = bo->peekSize();
+        vmBind.start = bo->peekAddress();
+        vmBind.userptr = bo->getUserptr();
+
+        if (drm->isVmBindPatIndexProgrammingSupported()) {
+            UNRECOVERABLE_IF(bo->peekPatIndex() == CommonConstants::unsupportedPatIndex);
+            if (patIndexExtUsed) {
+                ioctlHelper->fillVmBindExtSetPat(vmBindExtSetPats[i], bo->peekPatIndex(), 0u);
+                vmBind.extensions = castToUint64(vmBindExtSetPats[i]);
+            }
+            vmBind.patIndex = bo->peekPatIndex();
         }
-        if (incrementFenceValue) {
-            if (drm->isPerContextVMRequired()) {
-                auto osContextLinux = static_cast<OsContextLinux *>(osContext);
-                osContextLinux->incFenceVal(vmHandleId);
-            } else {
-                drm->incFenceVal(vmHandleId);
+    }
+
+    std::unique_lock<std::mutex> lock;
+
+    // single user fence is signaled once whole batch is processed
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    bool incrementFenceValue = false;
+    if (ioctlHelper->isWaitBeforeBindRequired(bind)) {
+        if (drm->useVMBindImmediate()) {
+            lock = drm->lockBindFenceMutex();
+            incrementFenceValue = true;
+            programUserFence(drm, osContext, bufferObjects[0], vmBindExtUserFence, vmHandleId, 0u);
+            for (auto &vmBind : vmBinds) {
+                ioctlHelper->setVmBindUserFence(vmBind, vmBindExtUserFence);
             }
         }
     }
 
-    return ret;
+    auto ret = ioctlHelper->vmBindBatch(vmBinds, bind);
+    if (ret) {
+        return ret;
+    }
+    if (bind) {
+        for (auto bo : bufferObjects) {
+            drm->setNewResourceBoundToVM(bo, vmHandleId);
+        }
+    }
+    completePagingFence(drm, osContext, vmHandleId, bind, incrementFenceValue);
+
+    return 0;
 }
 
 int Drm::bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo) {
@@ -1545,6 +1620,54 @@ int Drm::unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObj
     return changeBufferObjectBinding(this, osContext, vmHandleId, bo, false);
 }
 
+int Drm::bindBufferObjects(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects) {
+    return changeBufferObjectsBinding(osContext, vmHandleId, bufferObjects, true);
+}
+
+int Drm::unbindBufferObjects(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects) {
+    return changeBufferObjectsBinding(osContext, vmHandleId, bufferObjects, false);
+}
+
+int Drm::changeBufferObjectsBinding(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind) {
+    auto changeSingleBinding = [&](BufferObject *bo) {
+        return bind ? bo->bind(osContext, vmHandleId) : bo->unbind(osContext, vmHandleId);
+    };
+
+    std::vector<BufferObject *> batchedBufferObjects;
+    batchedBufferObjects.reserve(bufferObjects.size());
+    for (auto bo : bufferObjects) {
+        if (bo->getBindInfo()[bo->getOsContextId(osContext)][vmHandleId] == bind) {
+            continue;
+        }
+        // colouring and debug extensions require per buffer object ioctl parameters
+        if (!ioctlHelper->isVmBindBatchSupported() || bo->getColourWithBind() || !bo->getBindExtHandles().empty()) {
+            auto ret = changeSingleBinding(bo);
+            if (ret) {
+                return ret;
+            }
+            continue;
+        }
+        batchedBufferObjects.push_back(bo);
+    }
+
+    if (batchedBufferObjects.size() > 1u &&
+        changeBufferObjectsBindingBatched(this, osContext, vmHandleId, batchedBufferObjects, bind) == 0) {
+        for (auto bo : batchedBufferObjects) {
+            bo->updateBindInfo(osContext, vmHandleId, bind, 0);
+        }
+        return 0;
+    }
+
+    // single operations evict unused allocations on failure and report result per buffer object
+    for (auto bo : batchedBufferObjects) {
+        auto ret = changeSingleBinding(bo);
+        if (ret) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
 int Drm::createDrmVirtualMemory(uint32_t &drmVmId) {
     GemVmControl ctl{};
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -123,6 +123,8 @@ class Drm : public DriverModel {
     uint32_t getVirtualMemoryAddressSpace(uint32_t vmId) const;
     MOCKABLE_VIRTUAL int bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
     MOCKABLE_VIRTUAL int unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
+    MOCKABLE_VIRTUAL int bindBufferObjects(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects);
+    MOCKABLE_VIRTUAL int unbindBufferObjects(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects);
     int setupHardwareInfo(const DeviceDescriptor *, bool);
     void setupSystemInfo(HardwareInfo *hwInfo, SystemInfo *sysInfo);
     void setupCacheInfo(const HardwareInfo &hwInfo);
@@ -164,6 +166,10 @@ class Drm : public DriverModel {
     MOCKABLE_VIRTUAL bool isVmBindAvailable();
     MOCKABLE_VIRTUAL bool registerResourceClasses();
 
+    // Changed whenever any buffer object gets unbound, allocations made resident at older generation need to be bound again
+    const std::atomic<uint32_t> &getResidencyGeneration() const { return residencyGeneration; }
+    void incrementResidencyGeneration() { residencyGeneration.fetch_add(1u, std::memory_order_acq_rel); }
+
     MOCKABLE_VIRTUAL void queryPageFaultSupport();
     bool hasPageFaultSupport() const;
     bool hasKmdMigrationSupport() const;
@@ -282,6 +288,7 @@ class Drm : public DriverModel {
     bool queryDeviceIdAndRevision();
     bool queryI915DeviceIdAndRevision();
     static uint64_t alignUpGttSize(uint64_t inputGttSize);
+    int changeBufferObjectsBinding(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind);
 
 #pragma pack(1)
     struct PCIConfig {
@@ -360,6 +367,7 @@ class Drm : public DriverModel {
     uint32_t gpuFaultCheckThreshold = 10u;
 
     std::atomic<uint32_t> gpuFaultCheckCounter{0u};
+    std::atomic<uint32_t> residencyGeneration{1u};
 
     bool memoryInfoQueried = false;
     bool engineInfoQueried = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@ char *realpath(const char *path, char *buf);
 int stat(const std::string &filePath, struct stat *statbuf);
 int pipe(int pipefd[2]);
 int flock(int fd, int flag);
+int ftruncate(int fd, off_t length);
 int mkstemp(char *filePath);
 int rename(const char *currName, const char *dstName);
 int scandir(const char *dirp,
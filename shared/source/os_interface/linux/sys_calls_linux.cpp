@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,6 +156,10 @@ int flock(int fd, int flag) {
     return ::flock(fd, flag);
 }
 
+int ftruncate(int fd, off_t length) {
+    return ::ftruncate(fd, length);
+}
+
 int rename(const char *currName, const char *dstName) {
     return ::rename(currName, dstName);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1278,34 +1278,74 @@ int IoctlHelperXe::createDrmContext(Drm &drm, OsContextLinux &osContext, uint32_
     return drmContextId;
 }
 
-int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
-    constexpr int invalidIndex = -1;
-    auto gmmHelper = drm.getRootDeviceEnvironment().getGmmHelper();
-    int ret = -1;
-    const char *operation = isBind ? "bind" : "unbind";
-    int index = invalidIndex;
-
+int IoctlHelperXe::getBindInfoIndex(const VmBindParams &vmBindParams, bool isBind) const {
     if (isBind) {
         for (auto i = 0u; i < bindInfo.size(); i++) {
             if (vmBindParams.handle && vmBindParams.handle == bindInfo[i].handle) {
-                index = i;
-                break;
+                return i;
             }
             if (vmBindParams.userptr && vmBindParams.userptr == bindInfo[i].userptr) {
-                index = i;
-                break;
+                return i;
             }
         }
     } else // unbind
     {
+        auto gmmHelper = drm.getRootDeviceEnvironment().getGmmHelper();
         auto address = gmmHelper->decanonize(vmBindParams.start);
         for (auto i = 0u; i < bindInfo.size(); i++) {
             if (address == bindInfo[i].addr) {
-                index = i;
-                break;
+                return i;
             }
         }
     }
+    return invalidIndex;
+}
+
+void IoctlHelperXe::fillVmBindOp(drm_xe_vm_bind_op &bindOp, const VmBindParams &vmBindParams, int index, bool isBind) {
+    auto gmmHelper = drm.getRootDeviceEnvironment().getGmmHelper();
+
+    bindOp.range = vmBindParams.length;
+    bindOp.addr = gmmHelper->decanonize(vmBindParams.start);
+    bindOp.obj_offset = vmBindParams.offset;
+    bindOp.pat_index = static_cast<uint16_t>(vmBindParams.patIndex);
+    bindOp.extensions = vmBindParams.extensions;
+    bindOp.flags = static_cast<uint32_t>(vmBindParams.flags);
+
+    if (isBind) {
+        bindOp.op = DRM_XE_VM_BIND_OP_MAP;
+        bindOp.obj = vmBindParams.handle;
+        if (bindInfo[index].userptr) {
+            bindOp.op = DRM_XE_VM_BIND_OP_MAP_USERPTR;
+            bindOp.obj = 0;
+            bindOp.obj_offset = bindInfo[index].userptr;
+        }
+    } else {
+        bindOp.op = DRM_XE_VM_BIND_OP_UNMAP;
+        bindOp.obj = 0;
+        if (bindInfo[index].userptr) {
+            bindOp.obj_offset = bindInfo[index].userptr;
+        }
+    }
+
+    bindInfo[index].addr = bindOp.addr;
+}
+
+int IoctlHelperXe::waitForVmBindUserFence(uint32_t execQueueId, uint64_t address, uint64_t value) {
+    constexpr auto oneSecTimeout = 1000000000ll;
+    constexpr auto infiniteTimeout = -1;
+    bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
+    uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
+    if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
+        timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
+    }
+    return xeWaitUserFence(execQueueId, DRM_XE_UFENCE_WAIT_OP_EQ, address, value, timeout,
+                           false, NEO::InterruptId::notUsed, nullptr);
+}
+
+int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
+    int ret = -1;
+    const char *operation = isBind ? "bind" : "unbind";
+    int index = getBindInfoIndex(vmBindParams, isBind);
 
     if (index != invalidIndex) {
         drm_xe_vm_bind bind = {};
@@ -1313,12 +1353,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
         bind.num_syncs = 1;
         bind.num_binds = 1;
 
-        bind.bind.range = vmBindParams.length;
-        bind.bind.addr = gmmHelper->decanonize(vmBindParams.start);
-        bind.bind.obj_offset = vmBindParams.offset;
-        bind.bind.pat_index = static_cast<uint16_t>(vmBindParams.patIndex);
-        bind.bind.extensions = vmBindParams.extensions;
-        bind.bind.flags = static_cast<uint32_t>(vmBindParams.flags);
+        fillVmBindOp(bind.bind, vmBindParams, index, isBind);
 
         UNRECOVERABLE_IF(vmBindParams.userFence == 0x0);
         drm_xe_sync sync[1] = {};
@@ -1332,24 +1367,6 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
         sync[0].timeline_value = xeBindExtUserFence->value;
         bind.syncs = reinterpret_cast<uintptr_t>(&sync);
 
-        if (isBind) {
-            bind.bind.op = DRM_XE_VM_BIND_OP_MAP;
-            bind.bind.obj = vmBindParams.handle;
-            if (bindInfo[index].userptr) {
-                bind.bind.op = DRM_XE_VM_BIND_OP_MAP_USERPTR;
-                bind.bind.obj = 0;
-                bind.bind.obj_offset = bindInfo[index].userptr;
-            }
-        } else {
-            bind.bind.op = DRM_XE_VM_BIND_OP_UNMAP;
-            bind.bind.obj = 0;
-            if (bindInfo[index].userptr) {
-                bind.bind.obj_offset = bindInfo[index].userptr;
-            }
-        }
-
-        bindInfo[index].addr = bind.bind.addr;
-
         ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
 
         xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx operation=%d(%s) flags=%d(%s) nsy=%d pat=%hu ret=%d\n",
@@ -1371,17 +1388,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
             return ret;
         }
 
-        constexpr auto oneSecTimeout = 1000000000ll;
-        constexpr auto infiniteTimeout = -1;
-        bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
-        uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
-        if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
-            timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
-        }
-        return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
-                               sync[0].addr,
-                               sync[0].timeline_value, timeout,
-                               false, NEO::InterruptId::notUsed, nullptr);
+        return waitForVmBindUserFence(bind.exec_queue_id, sync[0].addr, sync[0].timeline_value);
     }
 
     xeLog("error:  -> IoctlHelperXe::%s %s index=%d vmid=0x%x h=0x%x s=0x%llx o=0x%llx l=0x%llx f=0x%llx pat=%hu r=%d\n",
@@ -1392,6 +1399,57 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
     return ret;
 }
 
+int IoctlHelperXe::vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool isBind) {
+    if (vmBindParams.size() == 1u) {
+        return xeVmBind(vmBindParams[0], isBind);
+    }
+
+    const char *operation = isBind ? "bind" : "unbind";
+    std::vector<int> indices(vmBindParams.size());
+    for (auto i = 0u; i < vmBindParams.size(); i++) {
+        indices[i] = getBindInfoIndex(vmBindParams[i], isBind);
+        if (indices[i] == invalidIndex) {
+            xeLog("error:  -> IoctlHelperXe::%s %s h=0x%x s=0x%llx not found\n", __FUNCTION__, operation, vmBindParams[i].handle, vmBindParams[i].start);
+            return -1;
+        }
+    }
+
+    std::vector<drm_xe_vm_bind_op> bindOps(vmBindParams.size());
+    for (auto i = 0u; i < vmBindParams.size(); i++) {
+        fillVmBindOp(bindOps[i], vmBindParams[i], indices[i], isBind);
+    }
+
+    drm_xe_vm_bind bind = {};
+    bind.vm_id = vmBindParams[0].vmId;
+    bind.num_syncs = 1;
+    bind.num_binds = static_cast<uint32_t>(bindOps.size());
+    bind.vector_of_binds = castToUint64(bindOps.data());
+
+    // all operations share user fence of first one, it signals completion of whole array
+    UNRECOVERABLE_IF(vmBindParams[0].userFence == 0x0);
+    drm_xe_sync sync[1] = {};
+
+    auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams[0].userFence);
+    UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
+
+    sync[0].type = DRM_XE_SYNC_TYPE_USER_FENCE;
+    sync[0].flags = DRM_XE_SYNC_FLAG_SIGNAL;
+    sync[0].addr = xeBindExtUserFence->addr;
+    sync[0].timeline_value = xeBindExtUserFence->value;
+    bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+
+    auto ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
+
+    xeLog(" vm=%d operation=%s num_binds=%u nsy=%d ret=%d\n", bind.vm_id, operation, bind.num_binds, bind.num_syncs, ret);
+
+    if (ret != 0) {
+        xeLog("error: %s\n", operation);
+        return ret;
+    }
+
+    return waitForVmBindUserFence(bind.exec_queue_id, sync[0].addr, sync[0].timeline_value);
+}
+
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
     switch (drmParam) {
     case DrmParam::contextCreateExtSetparam:
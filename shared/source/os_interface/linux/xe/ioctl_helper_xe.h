@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@ namespace XeDrm {
 struct drm_xe_engine_class_instance; // NOLINT(readability-identifier-naming)
 struct drm_xe_query_gt_list;         // NOLINT(readability-identifier-naming)
 struct drm_xe_query_config;          // NOLINT(readability-identifier-naming)
+struct drm_xe_vm_bind_op;            // NOLINT(readability-identifier-naming)
 } // namespace XeDrm
 
 enum class EngineClass : uint16_t;
@@ -81,6 +82,8 @@ class IoctlHelperXe : public IoctlHelper {
     std::optional<uint32_t> getVmAdviseAtomicAttribute() override;
     int vmBind(const VmBindParams &vmBindParams) override;
     int vmUnbind(const VmBindParams &vmBindParams) override;
+    bool isVmBindBatchSupported() const override { return true; }
+    int vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool isBind) override;
     int getResetStats(ResetStats &resetStats, uint32_t *status, ResetStatsFault *resetStatsFault) override;
     bool getEuStallProperties(std::array<uint64_t, 12u> &properties, uint64_t dssBufferSize, uint64_t samplingRate, uint64_t pollPeriod,
                               uint64_t engineInstance, uint64_t notifyNReports) override;
@@ -146,6 +149,9 @@ class IoctlHelperXe : public IoctlHelper {
     virtual int xeWaitUserFence(uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait);
     void setupXeWaitUserFenceStruct(void *arg, uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    int getBindInfoIndex(const VmBindParams &vmBindParams, bool isBind) const;
+    void fillVmBindOp(XeDrm::drm_xe_vm_bind_op &bindOp, const VmBindParams &vmBindParams, int index, bool isBind);
+    int waitForVmBindUserFence(uint32_t execQueueId, uint64_t address, uint64_t value);
     void xeShowBindTable();
     void updateBindInfo(uint32_t handle, uint64_t userPtr, uint64_t size);
     int debuggerOpenIoctl(DrmIoctl request, void *arg);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/program/heap_info.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
 #include <string>
@@ -39,6 +40,16 @@ struct DeviceInfoKernelPayloadConstants {
     uint32_t maxWorkGroupSize = 0U;
 };
 
+// Kernel's section of .ze_info kept for decoding kernel descriptor on first use (see ProgramInfo::deferKernelsZeInfoDecoding),
+// references device binary, which has to outlive KernelInfo
+struct DeferredZeInfoKernel {
+    ConstStringRef kernelSection;
+    uint32_t grfSize = 0U;
+    uint32_t minScratchSpaceSize = 0U;
+    uint32_t zeInfoVersionMajor = 0U;
+    uint32_t zeInfoVersionMinor = 0U;
+};
+
 struct KernelInfo {
   public:
     KernelInfo() = default;
@@ -82,6 +93,10 @@ struct KernelInfo {
         return kernelDescriptor.kernelAttributes.flags.usesVme;
     }
 
+    bool isKernelDescriptorDeferred() const {
+        return false == deferredZeInfo.kernelSection.empty();
+    }
+
     uint32_t getConstantBufferSize() const;
     int32_t getArgNumByName(const char *name) const;
 
@@ -102,6 +117,7 @@ struct KernelInfo {
 
     uint64_t shaderHashCode;
     KernelDescriptor kernelDescriptor;
+    DeferredZeInfoKernel deferredZeInfo;
 };
 
 std::string concatenateKernelNames(ArrayRef<KernelInfo *> kernelInfos);
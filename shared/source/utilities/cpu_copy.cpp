@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/parallel_task_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace NEO {
+namespace CpuCopy {
+
+void copyNonTemporal(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    // streaming stores require aligned destination
+    auto headSize = std::min(size, static_cast<size_t>(ptrDiff(alignUp(dstBytes, sizeof(__m128i)), dstBytes)));
+    if (headSize > 0u) {
+        memcpy_s(dstBytes, headSize, srcBytes, headSize);
+        dstBytes += headSize;
+        srcBytes += headSize;
+        size -= headSize;
+    }
+
+    for (; size >= nonTemporalBlockSize; size -= nonTemporalBlockSize) {
+        auto srcVectors = reinterpret_cast<const __m128i *>(srcBytes);
+        auto dstVectors = reinterpret_cast<__m128i *>(dstBytes);
+        auto value0 = _mm_loadu_si128(srcVectors);
+        auto value1 = _mm_loadu_si128(srcVectors + 1);
+        auto value2 = _mm_loadu_si128(srcVectors + 2);
+        auto value3 = _mm_loadu_si128(srcVectors + 3);
+        _mm_stream_si128(dstVectors, value0);
+        _mm_stream_si128(dstVectors + 1, value1);
+        _mm_stream_si128(dstVectors + 2, value2);
+        _mm_stream_si128(dstVectors + 3, value3);
+        dstBytes += nonTemporalBlockSize;
+        srcBytes += nonTemporalBlockSize;
+    }
+    for (; size >= sizeof(__m128i); size -= sizeof(__m128i)) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += sizeof(__m128i);
+        srcBytes += sizeof(__m128i);
+    }
+
+    if (size > 0u) {
+        memcpy_s(dstBytes, size, srcBytes, size);
+    }
+    _mm_sfence();
+}
+
+void copy(void *dst, const void *src, size_t size, bool nonTemporal, ParallelTaskPool *taskPool, size_t chunkSize) {
+    auto copyChunk = [&](size_t offset, size_t chunk) {
+        if (nonTemporal) {
+            copyNonTemporal(ptrOffset(dst, offset), ptrOffset(src, offset), chunk);
+        } else {
+            memcpy_s(ptrOffset(dst, offset), chunk, ptrOffset(src, offset), chunk);
+        }
+    };
+
+    chunkSize = alignUp(std::max(chunkSize, nonTemporalBlockSize), nonTemporalBlockSize);
+    if (taskPool == nullptr || taskPool->getNumWorkers() == 0u || size <= chunkSize) {
+        copyChunk(0u, size);
+        return;
+    }
+
+    const auto numChunks = (size + chunkSize - 1) / chunkSize;
+    taskPool->run(numChunks, [&](size_t chunkId) {
+        const auto offset = chunkId * chunkSize;
+        copyChunk(offset, std::min(chunkSize, size - offset));
+    });
+}
+
+} // namespace CpuCopy
+} // namespace NEO
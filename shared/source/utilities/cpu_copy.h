@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2024-2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+
+namespace NEO {
+class ParallelTaskPool;
+
+namespace CpuCopy {
+inline constexpr size_t defaultChunkSize = 512 * MemoryConstants::kiloByte;
+inline constexpr size_t nonTemporalBlockSize = 64u;
+
+// Copy with streaming stores bypassing CPU caches, intended for write-combined destination such as locked device memory.
+// Stores are fenced before return.
+void copyNonTemporal(void *dst, const void *src, size_t size);
+
+// Copy split into chunks of chunkSize bytes executed by task pool workers, single threaded when no pool is given.
+void copy(void *dst, const void *src, size_t size, bool nonTemporal, ParallelTaskPool *taskPool, size_t chunkSize);
+} // namespace CpuCopy
+} // namespace NEO
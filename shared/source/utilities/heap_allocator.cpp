@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,19 +32,25 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
-    std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+    const bool bigChunk = sizeToAllocate > sizeThreshold;
+    std::vector<HeapChunk> &freedChunks = bigChunk ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
     for (;;) {
         size_t sizeOfFreedChunk = 0;
-        uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
+        uint64_t ptrReturn = 0llu;
+        if (isSegregatedFit()) {
+            ptrReturn = getFromSegregatedFreeChunks(sizeToAllocate, bigChunk ? *segregatedChunksBig : *segregatedChunksSmall, alignment);
+        } else {
+            ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
+        }
 
         if (ptrReturn == 0llu) {
-            if (sizeToAllocate > sizeThreshold) {
+            if (bigChunk) {
                 const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
                 if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
                     if (misalignment) {
-                        storeInFreedChunks(pLeftBound, static_cast<size_t>(misalignment), freedChunks);
+                        storeFreedChunk(pLeftBound, static_cast<size_t>(misalignment), bigChunk);
                         pLeftBound += misalignment;
                     }
                     ptrReturn = pLeftBound;
@@ -56,7 +62,7 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
                 if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
                     if (misalignment) {
                         pRightBound -= misalignment;
-                        storeInFreedChunks(pRightBound, static_cast<size_t>(misalignment), freedChunks);
+                        storeFreedChunk(pRightBound, static_cast<size_t>(misalignment), bigChunk);
                     }
                     pRightBound -= sizeToAllocate;
                     ptrReturn = pRightBound;
@@ -75,7 +81,8 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
             return ptrReturn;
         }
 
-        if (defragmentCount == 1)
+        // segregated free chunks are coalesced on free, there is nothing to defragment
+        if (defragmentCount == 1 || isSegregatedFit())
             return 0llu;
         defragment();
         defragmentCount++;
@@ -97,9 +104,9 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
         mergeLastFreedBig();
     } else if (ptr < pLeftBound) {
         DEBUG_BREAK_IF(size <= sizeThreshold);
-        storeInFreedChunks(ptr, size, freedChunksBig);
+        storeFreedChunk(ptr, size, true);
     } else {
-        storeInFreedChunks(ptr, size, freedChunksSmall);
+        storeFreedChunk(ptr, size, false);
     }
     availableSize += size;
 }
@@ -166,6 +173,24 @@ uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &
     return 0llu;
 }
 
+uint64_t HeapAllocator::getFromSegregatedFreeChunks(size_t size, SegregatedFreeChunks &freeChunks, size_t requiredAlignment) {
+    // extra space guarantees that chunk contains aligned range of requested size
+    auto chunk = freeChunks.take(size + requiredAlignment - allocationAlignment);
+    if (chunk.size == 0u) {
+        return 0llu;
+    }
+
+    const uint64_t ptr = alignUp(chunk.ptr, requiredAlignment);
+    if (ptr + size > chunk.ptr + chunk.size) {
+        freeChunks.store(chunk.ptr, chunk.size);
+        return 0llu;
+    }
+
+    freeChunks.store(chunk.ptr, static_cast<size_t>(ptr - chunk.ptr));
+    freeChunks.store(ptr + size, static_cast<size_t>(chunk.ptr + chunk.size - (ptr + size)));
+    return ptr;
+}
+
 void HeapAllocator::defragment() {
 
     if (freedChunksSmall.size() > 1) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,10 @@
 #pragma once
 
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/segregated_free_chunks.h"
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -25,17 +27,28 @@ bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
 class HeapAllocator {
   public:
+    static constexpr size_t defaultSizeThreshold = 4 * MemoryConstants::megaByte;
+
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, 4 * MemoryConstants::megaByte) {
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, defaultSizeThreshold) {
+    }
+
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : HeapAllocator(address, size, allocationAlignment, threshold, false) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
+    // segregatedFit selects size-class indexed free chunks with immediate coalescing instead of linear scans and defragmentation
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold, bool segregatedFit) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
+        if (segregatedFit) {
+            segregatedChunksSmall = std::make_unique<SegregatedFreeChunks>();
+            segregatedChunksBig = std::make_unique<SegregatedFreeChunks>();
+        } else {
+            freedChunksBig.reserve(10);
+            freedChunksSmall.reserve(50);
+        }
     }
 
     MOCKABLE_VIRTUAL ~HeapAllocator() = default;
@@ -58,6 +71,10 @@ class HeapAllocator {
 
     double getUsage() const;
 
+    bool isSegregatedFit() const {
+        return segregatedChunksSmall != nullptr;
+    }
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -68,9 +85,20 @@ class HeapAllocator {
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
+    std::unique_ptr<SegregatedFreeChunks> segregatedChunksSmall;
+    std::unique_ptr<SegregatedFreeChunks> segregatedChunksBig;
     std::mutex mtx;
 
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
+    uint64_t getFromSegregatedFreeChunks(size_t size, SegregatedFreeChunks &freeChunks, size_t requiredAlignment);
+
+    void storeFreedChunk(uint64_t ptr, size_t size, bool bigChunk) {
+        if (isSegregatedFit()) {
+            (bigChunk ? segregatedChunksBig : segregatedChunksSmall)->store(ptr, size);
+        } else {
+            storeInFreedChunks(ptr, size, bigChunk ? freedChunksBig : freedChunksSmall);
+        }
+    }
 
     void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
         for (auto &freedChunk : freedChunks) {
@@ -96,6 +124,11 @@ class HeapAllocator {
     }
 
     void mergeLastFreedSmall() {
+        if (isSegregatedFit()) {
+            pRightBound += segregatedChunksSmall->takeStartingAt(pRightBound).size;
+            return;
+        }
+
         size_t maxSizeOfSmallChunks = freedChunksSmall.size();
 
         if (maxSizeOfSmallChunks > 0) {
@@ -109,6 +142,11 @@ class HeapAllocator {
     }
 
     void mergeLastFreedBig() {
+        if (isSegregatedFit()) {
+            pLeftBound -= segregatedChunksBig->takeEndingAt(pLeftBound).size;
+            return;
+        }
+
         size_t maxSizeOfBigChunks = freedChunksBig.size();
 
         if (maxSizeOfBigChunks > 0) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -219,6 +219,11 @@ class IDList {
         return processLocked<ThisType, &ThisType::detachNodesImpl>();
     }
 
+    // detaches up to count nodes from the front, count is updated with number of detached nodes
+    NodeObjectType *detachFrontNodes(size_t &count) {
+        return processLocked<ThisType, &ThisType::detachFrontNodesImpl>(nullptr, &count);
+    }
+
     void splice(NodeObjectType &nodes) {
         processLocked<ThisType, &ThisType::spliceImpl>(&nodes);
     }
@@ -417,6 +422,23 @@ class IDList {
         return rest;
     }
 
+    NodeObjectType *detachFrontNodesImpl(NodeObjectType *, void *data) {
+        auto &count = *static_cast<size_t *>(data);
+        if (head == nullptr || count == 0) {
+            count = 0;
+            return nullptr;
+        }
+
+        NodeObjectType *last = head;
+        size_t detachedCount = 1;
+        while (detachedCount < count && last->next != nullptr) {
+            last = last->next;
+            detachedCount++;
+        }
+        count = detachedCount;
+        return detachSequenceImpl(head, last);
+    }
+
     NodeObjectType *spliceImpl(NodeObjectType *node, void *) {
         if (tail == nullptr) {
             DEBUG_BREAK_IF(head != nullptr);
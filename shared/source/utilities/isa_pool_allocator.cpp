@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,10 +8,13 @@
 #include "shared/source/utilities/isa_pool_allocator.h"
 
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 
+#include <string_view>
+
 namespace NEO {
 
 ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize)
@@ -72,7 +75,52 @@ ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
  */
 SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBuiltin, size_t size) {
     std::unique_lock lock(allocatorMtx);
+    return allocateISA(isBuiltin, size);
+}
+
+/**
+ * @brief This method returns SharedIsaAllocation for position independent ISA image.
+ * Users requesting identical ISA image share single chunk, which is refcounted and
+ * released when the last user frees its SharedIsaAllocation.
+ * Image is uploaded by the first user, see DeduplicatedIsa::uploaded.
+ *
+ * @param[in] isBuiltin flag specifying whether ISA will be used for builtin kernels
+ * @param[in] isaImage staged ISA, exactly as it should be placed in the chunk.
+ *
+ * @return returns SharedIsaAllocation or nullptr if allocation didn't succeeded
+ */
+SharedIsaAllocation *ISAPoolAllocator::requestDeduplicatedIsa(bool isBuiltin, std::vector<uint8_t> &&isaImage) {
+    // images are compared on lookup, so fast non-cryptographic hash is sufficient
+    const uint64_t contentHash = std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char *>(isaImage.data()), isaImage.size()));
 
+    std::unique_lock lock(allocatorMtx);
+    auto [first, last] = deduplicatedIsas.equal_range(contentHash);
+    for (auto it = first; it != last; ++it) {
+        auto &deduplicatedIsa = *it->second;
+        if (deduplicatedIsa.isBuiltin == isBuiltin && deduplicatedIsa.isaImage == isaImage) {
+            deduplicatedIsa.refCount++;
+            return new SharedIsaAllocation{*deduplicatedIsa.chunk, &deduplicatedIsa};
+        }
+    }
+
+    auto sharedIsaAllocation = allocateISA(isBuiltin, isaImage.size());
+    if (sharedIsaAllocation == nullptr) {
+        return nullptr;
+    }
+
+    auto deduplicatedIsa = std::make_unique<DeduplicatedIsa>();
+    deduplicatedIsa->isaImage = std::move(isaImage);
+    deduplicatedIsa->contentHash = contentHash;
+    deduplicatedIsa->isBuiltin = isBuiltin;
+    deduplicatedIsa->chunk.reset(sharedIsaAllocation);
+    deduplicatedIsa->refCount = 1u;
+
+    auto deduplicatedIsaAllocation = new SharedIsaAllocation{*sharedIsaAllocation, deduplicatedIsa.get()};
+    deduplicatedIsas.emplace(contentHash, std::move(deduplicatedIsa));
+    return deduplicatedIsaAllocation;
+}
+
+SharedIsaAllocation *ISAPoolAllocator::allocateISA(bool isBuiltin, size_t size) {
     auto maxAllocationSize = getAllocationSize(isBuiltin);
 
     if (size > maxAllocationSize) {
@@ -101,9 +149,24 @@ SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBu
  * @param[in] sharedIsaAllocation SharedIsaAllocation to free.
  *
  * @note actual chunk is not released immediately, it's freed during drain call.
+ * Chunk of deduplicated ISA is released when its last user frees it.
  */
 void ISAPoolAllocator::freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation) {
     std::unique_lock lock(allocatorMtx);
+    if (auto deduplicatedIsa = sharedIsaAllocation->getDeduplicatedIsa(); deduplicatedIsa != nullptr) {
+        DEBUG_BREAK_IF(deduplicatedIsa->refCount == 0u);
+        if (--deduplicatedIsa->refCount > 0u) {
+            delete sharedIsaAllocation;
+            return;
+        }
+        auto [first, last] = deduplicatedIsas.equal_range(deduplicatedIsa->contentHash);
+        for (auto it = first; it != last; ++it) {
+            if (it->second.get() == deduplicatedIsa) {
+                deduplicatedIsas.erase(it);
+                break;
+            }
+        }
+    }
     tryFreeFromPoolBuffer(sharedIsaAllocation->getGraphicsAllocation(), sharedIsaAllocation->getOffset(), sharedIsaAllocation->getSize());
     delete sharedIsaAllocation;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,16 +10,26 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/buffer_pool_allocator.h"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
 class Device;
 
+struct DeduplicatedIsa;
+
 class SharedIsaAllocation {
   public:
     SharedIsaAllocation(GraphicsAllocation *graphicsAllocation, size_t offset, size_t size, std::mutex *mtx)
         : graphicsAllocation(graphicsAllocation), offset(offset), size(size), mtx(*mtx){};
+    SharedIsaAllocation(const SharedIsaAllocation &chunk, DeduplicatedIsa *deduplicatedIsa)
+        : SharedIsaAllocation(chunk) {
+        this->deduplicatedIsa = deduplicatedIsa;
+    };
 
     GraphicsAllocation *getGraphicsAllocation() const {
         return graphicsAllocation;
@@ -37,11 +47,26 @@ class SharedIsaAllocation {
         return std::unique_lock<std::mutex>(mtx);
     }
 
+    DeduplicatedIsa *getDeduplicatedIsa() const {
+        return deduplicatedIsa;
+    }
+
   private:
     GraphicsAllocation *graphicsAllocation;
     const size_t offset;
     const size_t size;
     std::mutex &mtx; // This mutex is shared across all users of this GA
+    DeduplicatedIsa *deduplicatedIsa = nullptr;
+};
+
+// Chunk holding position independent ISA, shared by all users requesting identical ISA image
+struct DeduplicatedIsa {
+    std::vector<uint8_t> isaImage;
+    uint64_t contentHash = 0u;
+    bool isBuiltin = false;
+    std::unique_ptr<SharedIsaAllocation> chunk;
+    uint32_t refCount = 0u;
+    std::atomic<bool> uploaded{false};
 };
 
 // Each shared GA is maintained by single ISAPool
@@ -69,9 +94,15 @@ class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAlloca
   public:
     ISAPoolAllocator(Device *device);
     SharedIsaAllocation *requestGraphicsAllocationForIsa(bool isBuiltin, size_t size);
+    SharedIsaAllocation *requestDeduplicatedIsa(bool isBuiltin, std::vector<uint8_t> &&isaImage);
     void freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation);
 
+    size_t getNumDeduplicatedIsas() const {
+        return deduplicatedIsas.size();
+    }
+
   private:
+    SharedIsaAllocation *allocateISA(bool isBuiltin, size_t size);
     SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
 
     size_t getAllocationSize(bool isBuiltin) const {
@@ -82,6 +113,7 @@ class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAlloca
     size_t userAllocationSize = MemoryConstants::pageSize2M * 2;
     size_t buitinAllocationSize = MemoryConstants::pageSize64k;
     std::mutex allocatorMtx;
+    std::unordered_multimap<uint64_t, std::unique_ptr<DeduplicatedIsa>> deduplicatedIsas;
 };
 
 } // namespace NEO
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_task_pool.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+namespace {
+thread_local bool isInsideTask = false;
+} // namespace
+
+ParallelTaskPool::ParallelTaskPool(uint32_t numWorkers) {
+    workers.reserve(numWorkers);
+    for (uint32_t i = 0u; i < numWorkers; i++) {
+        auto worker = Thread::createFunc(workerMain, reinterpret_cast<void *>(this));
+        if (worker == nullptr) {
+            break;
+        }
+        workers.push_back(std::move(worker));
+    }
+}
+
+ParallelTaskPool::~ParallelTaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        active = false;
+    }
+    jobAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+void ParallelTaskPool::run(size_t numTasks, const Task &task) {
+    if (numTasks == 0u) {
+        return;
+    }
+    const bool wasInsideTask = isInsideTask;
+    if (workers.empty() || numTasks == 1u || wasInsideTask) {
+        isInsideTask = true;
+        for (size_t taskId = 0u; taskId < numTasks; taskId++) {
+            task(taskId);
+        }
+        isInsideTask = wasInsideTask;
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        currentTask = &task;
+        currentNumTasks = numTasks;
+        nextTaskId.store(0u);
+        jobGeneration++;
+    }
+    jobAvailable.notify_all();
+
+    isInsideTask = true;
+    executeTasks(task, numTasks);
+    isInsideTask = false;
+
+    // workers woken after this point see no job
+    std::unique_lock<std::mutex> lock(jobMutex);
+    jobDone.wait(lock, [&]() { return numWorkersInJob == 0u; });
+    currentTask = nullptr;
+    currentNumTasks = 0u;
+}
+
+void ParallelTaskPool::executeTasks(const Task &task, size_t numTasks) {
+    for (auto taskId = nextTaskId.fetch_add(1u); taskId < numTasks; taskId = nextTaskId.fetch_add(1u)) {
+        task(taskId);
+    }
+}
+
+void *ParallelTaskPool::workerMain(void *arg) {
+    auto pool = reinterpret_cast<ParallelTaskPool *>(arg);
+    isInsideTask = true;
+    uint64_t lastJobGeneration = 0u;
+
+    std::unique_lock<std::mutex> lock(pool->jobMutex);
+    while (true) {
+        pool->jobAvailable.wait(lock, [&]() { return !pool->active || pool->jobGeneration != lastJobGeneration; });
+        if (!pool->active) {
+            return nullptr;
+        }
+        lastJobGeneration = pool->jobGeneration;
+        if (pool->currentTask == nullptr) {
+            continue;
+        }
+
+        const auto &task = *pool->currentTask;
+        const auto numTasks = pool->currentNumTasks;
+        pool->numWorkersInJob++;
+        lock.unlock();
+
+        pool->executeTasks(task, numTasks);
+
+        lock.lock();
+        pool->numWorkersInJob--;
+        if (pool->numWorkersInJob == 0u) {
+            pool->jobDone.notify_all();
+        }
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Fixed set of worker threads executing independent, indexed tasks.
+// Calling thread takes part in execution and run() returns only after all tasks are done, so tasks
+// may reference caller's stack. Each task should write only its own outputs - results are deterministic then.
+// One job is executed at a time, run() called from within a task executes tasks inline.
+class ParallelTaskPool {
+  public:
+    using Task = std::function<void(size_t taskId)>;
+
+    explicit ParallelTaskPool(uint32_t numWorkers);
+    ~ParallelTaskPool();
+
+    ParallelTaskPool(const ParallelTaskPool &) = delete;
+    ParallelTaskPool &operator=(const ParallelTaskPool &) = delete;
+
+    void run(size_t numTasks, const Task &task);
+
+    uint32_t getNumWorkers() const {
+        return static_cast<uint32_t>(workers.size());
+    }
+
+  protected:
+    static void *workerMain(void *arg);
+    void executeTasks(const Task &task, size_t numTasks);
+
+    std::vector<std::unique_ptr<Thread>> workers;
+
+    std::mutex runMutex;
+    std::mutex jobMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobDone;
+
+    const Task *currentTask = nullptr;
+    size_t currentNumTasks = 0u;
+    std::atomic<size_t> nextTaskId{0u};
+    uint64_t jobGeneration = 0u;
+    uint32_t numWorkersInJob = 0u;
+    bool active = true;
+};
+
+} // namespace NEO
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/segregated_free_chunks.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+namespace NEO {
+
+namespace {
+uint32_t getMinLsbSet64(uint64_t value) {
+    const auto lowPart = static_cast<uint32_t>(value);
+    if (lowPart != 0u) {
+        return Math::getMinLsbSet(lowPart);
+    }
+    return 32u + Math::getMinLsbSet(static_cast<uint32_t>(value >> 32));
+}
+} // namespace
+
+void SegregatedFreeChunks::getSizeClass(size_t size, uint32_t &firstLevel, uint32_t &secondLevel) {
+    if (size < secondLevelCount) {
+        firstLevel = 0u;
+        secondLevel = static_cast<uint32_t>(size);
+        return;
+    }
+    const auto sizeLog2 = Math::log2(static_cast<uint64_t>(size));
+    firstLevel = sizeLog2 - secondLevelBits + 1u;
+    secondLevel = static_cast<uint32_t>(size >> (sizeLog2 - secondLevelBits)) ^ secondLevelCount;
+}
+
+void SegregatedFreeChunks::store(uint64_t ptr, size_t size) {
+    if (size == 0u) {
+        return;
+    }
+
+    auto previousIt = chunkPtrsByEnd.find(ptr);
+    if (previousIt != chunkPtrsByEnd.end()) {
+        auto previousChunk = remove(previousIt->second);
+        ptr = previousChunk.ptr;
+        size += previousChunk.size;
+    }
+
+    if (chunks.find(ptr + size) != chunks.end()) {
+        size += remove(ptr + size).size;
+    }
+
+    insert(ptr, size);
+}
+
+HeapChunk SegregatedFreeChunks::take(size_t minSize) {
+    auto ptr = findSuitable(minSize);
+    if (ptr == invalidPtr) {
+        return HeapChunk(0u, 0u);
+    }
+    return remove(ptr);
+}
+
+HeapChunk SegregatedFreeChunks::takeStartingAt(uint64_t ptr) {
+    if (chunks.find(ptr) == chunks.end()) {
+        return HeapChunk(0u, 0u);
+    }
+    return remove(ptr);
+}
+
+HeapChunk SegregatedFreeChunks::takeEndingAt(uint64_t endPtr) {
+    auto it = chunkPtrsByEnd.find(endPtr);
+    if (it == chunkPtrsByEnd.end()) {
+        return HeapChunk(0u, 0u);
+    }
+    return remove(it->second);
+}
+
+uint64_t SegregatedFreeChunks::findSuitable(size_t minSize) const {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+
+    // round up to next size class, so any chunk from found class is big enough
+    size_t searchSize = minSize;
+    if (minSize >= secondLevelCount) {
+        const size_t roundUp = (size_t{1} << (Math::log2(static_cast<uint64_t>(minSize)) - secondLevelBits)) - 1u;
+        if (searchSize <= std::numeric_limits<size_t>::max() - roundUp) {
+            searchSize += roundUp;
+        }
+    }
+    getSizeClass(searchSize, firstLevel, secondLevel);
+
+    uint32_t secondLevelBitmap = secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelBitmap == 0u && firstLevel + 1u < firstLevelCount) {
+        const uint64_t firstLevelMask = firstLevelBitmap & (~0ull << (firstLevel + 1u));
+        if (firstLevelMask != 0u) {
+            firstLevel = getMinLsbSet64(firstLevelMask);
+            secondLevelBitmap = secondLevelBitmaps[firstLevel];
+        }
+    }
+    if (secondLevelBitmap != 0u) {
+        return listHeads[firstLevel * secondLevelCount + Math::getMinLsbSet(secondLevelBitmap)];
+    }
+
+    // rounding skips requested size class, it may still contain a chunk that fits
+    getSizeClass(minSize, firstLevel, secondLevel);
+    for (auto ptr = listHeads[firstLevel * secondLevelCount + secondLevel]; ptr != invalidPtr; ptr = chunks.at(ptr).next) {
+        if (chunks.at(ptr).size >= minSize) {
+            return ptr;
+        }
+    }
+    return invalidPtr;
+}
+
+void SegregatedFreeChunks::insert(uint64_t ptr, size_t size) {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    getSizeClass(size, firstLevel, secondLevel);
+
+    auto &head = listHeads[firstLevel * secondLevelCount + secondLevel];
+    if (head != invalidPtr) {
+        chunks.at(head).prev = ptr;
+    }
+    [[maybe_unused]] auto inserted = chunks.emplace(ptr, FreeChunk{size, invalidPtr, head}).second;
+    DEBUG_BREAK_IF(!inserted);
+    head = ptr;
+
+    chunkPtrsByEnd[ptr + size] = ptr;
+    secondLevelBitmaps[firstLevel] |= (1u << secondLevel);
+    firstLevelBitmap |= (1ull << firstLevel);
+    freeSize += size;
+}
+
+HeapChunk SegregatedFreeChunks::remove(uint64_t ptr) {
+    auto it = chunks.find(ptr);
+    DEBUG_BREAK_IF(it == chunks.end());
+    const auto chunk = it->second;
+
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    getSizeClass(chunk.size, firstLevel, secondLevel);
+
+    if (chunk.prev != invalidPtr) {
+        chunks.at(chunk.prev).next = chunk.next;
+    } else {
+        listHeads[firstLevel * secondLevelCount + secondLevel] = chunk.next;
+        if (chunk.next == invalidPtr) {
+            secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (secondLevelBitmaps[firstLevel] == 0u) {
+                firstLevelBitmap &= ~(1ull << firstLevel);
+            }
+        }
+    }
+    if (chunk.next != invalidPtr) {
+        chunks.at(chunk.next).prev = chunk.prev;
+    }
+
+    chunks.erase(it);
+    chunkPtrsByEnd.erase(ptr + chunk.size);
+    freeSize -= chunk.size;
+    return HeapChunk(ptr, chunk.size);
+}
+
+} // namespace NEO
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+
+namespace NEO {
+struct HeapChunk;
+
+// TLSF-style index of free address ranges.
+// Chunks are kept in size classes - power of two ranges split into secondLevelCount linear subranges - with
+// bitmaps of non-empty classes, so finding a chunk that fits is a couple of bit scans. Chunks are also indexed
+// by both boundaries, so freed ranges are coalesced with free neighbours immediately and no defragmentation is needed.
+class SegregatedFreeChunks {
+  public:
+    static constexpr uint32_t secondLevelBits = 4u;
+    static constexpr uint32_t secondLevelCount = 1u << secondLevelBits;
+    static constexpr uint32_t firstLevelCount = 64u - secondLevelBits + 1u;
+
+    SegregatedFreeChunks() {
+        listHeads.fill(invalidPtr);
+    }
+
+    void store(uint64_t ptr, size_t size);
+    HeapChunk take(size_t minSize);
+    HeapChunk takeStartingAt(uint64_t ptr);
+    HeapChunk takeEndingAt(uint64_t endPtr);
+
+    size_t getNumChunks() const {
+        return chunks.size();
+    }
+    uint64_t getFreeSize() const {
+        return freeSize;
+    }
+
+    static void getSizeClass(size_t size, uint32_t &firstLevel, uint32_t &secondLevel);
+
+  protected:
+    static constexpr uint64_t invalidPtr = std::numeric_limits<uint64_t>::max();
+
+    struct FreeChunk {
+        size_t size;
+        uint64_t prev;
+        uint64_t next;
+    };
+
+    uint64_t findSuitable(size_t minSize) const;
+    void insert(uint64_t ptr, size_t size);
+    HeapChunk remove(uint64_t ptr);
+
+    std::unordered_map<uint64_t, FreeChunk> chunks;
+    std::unordered_map<uint64_t, uint64_t> chunkPtrsByEnd;
+    std::array<uint64_t, firstLevelCount * secondLevelCount> listHeads;
+    std::array<uint32_t, firstLevelCount> secondLevelBitmaps = {};
+    uint64_t firstLevelBitmap = 0u;
+    uint64_t freeSize = 0u;
+};
+} // namespace NEO
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024-2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace NEO {
+
+// Ordered index of non-overlapping [ptr, ptr + value->size) ranges.
+// Same interface as BaseSortedPointerWithValueVector, but insert/remove/get are O(log n) regardless of insertion order.
+// Not thread safe, callers synchronize access. Every removal bumps removal epoch before erasing,
+// so lookup caches kept outside of the caller's lock can detect that cached entry may be gone.
+template <typename ValueType>
+class BaseSortedPointerWithValueMap {
+  public:
+    using Container = std::map<const void *, std::unique_ptr<ValueType>>;
+
+    BaseSortedPointerWithValueMap() = default;
+
+    static bool isInRange(const void *ptr, const void *basePtr, size_t size) {
+        return ptr == basePtr || (basePtr < ptr && (reinterpret_cast<uintptr_t>(ptr) < (reinterpret_cast<uintptr_t>(basePtr) + size)));
+    }
+
+    void insert(const void *ptr, const ValueType &value) {
+        auto inserted = allocations.emplace(ptr, std::make_unique<ValueType>(value)).second;
+        UNRECOVERABLE_IF(!inserted);
+    }
+
+    void remove(const void *ptr) {
+        removalEpoch++;
+        allocations.erase(ptr);
+    }
+
+    typename Container::iterator getImpl(const void *ptr, bool allowOffset) {
+        if (nullptr == ptr) {
+            return allocations.end();
+        }
+
+        auto it = allocations.upper_bound(ptr);
+        if (it == allocations.begin()) {
+            return allocations.end();
+        }
+        --it;
+
+        const size_t allowedOffset = allowOffset ? it->second->size : 0u;
+        if (isInRange(ptr, it->first, allowedOffset)) {
+            return it;
+        }
+        return allocations.end();
+    }
+
+    std::unique_ptr<ValueType> extract(const void *ptr) {
+        std::unique_ptr<ValueType> retVal{};
+        auto it = allocations.find(ptr);
+        if (it != allocations.end()) {
+            removalEpoch++;
+            retVal.swap(it->second);
+            allocations.erase(it);
+        }
+        return retVal;
+    }
+
+    ValueType *get(const void *ptr) {
+        auto it = getImpl(ptr, true);
+        if (it != allocations.end()) {
+            return it->second.get();
+        }
+        return nullptr;
+    }
+
+    size_t getNumAllocs() const { return allocations.size(); }
+    uint64_t getRemovalEpoch() const { return removalEpoch.load(std::memory_order_acquire); }
+
+    Container allocations;
+
+  protected:
+    std::atomic<uint64_t> removalEpoch{0u};
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,16 +9,22 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/thread_cache_registry.h"
 
 namespace NEO {
 
 TagAllocatorBase::TagAllocatorBase(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes, DeviceBitfield deviceBitfield)
-    : deviceBitfield(deviceBitfield), rootDeviceIndices(rootDeviceIndices), memoryManager(memMngr), tagCount(tagCount), tagSize(tagSize), doNotReleaseNodes(doNotReleaseNodes) {
+    : allocatorId(ThreadCacheRegistry::registerOwner()), deviceBitfield(deviceBitfield), rootDeviceIndices(rootDeviceIndices), memoryManager(memMngr), tagCount(tagCount), tagSize(tagSize), doNotReleaseNodes(doNotReleaseNodes) {
 
     this->tagSize = alignUp(tagSize, tagAlignment);
     maxRootDeviceIndex = *std::max_element(std::begin(rootDeviceIndices), std::end(rootDeviceIndices));
 }
 
+TagAllocatorBase::~TagAllocatorBase() {
+    cleanUpResources();
+    ThreadCacheRegistry::unregisterOwner(this->allocatorId);
+}
+
 void TagAllocatorBase::cleanUpResources() {
     for (auto &multiGfxAllocation : gfxAllocations) {
         for (auto &allocation : multiGfxAllocation->getGraphicsAllocations()) {
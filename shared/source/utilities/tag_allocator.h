@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
@@ -16,7 +17,9 @@
 #include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <memory>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -138,7 +141,7 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
 
 class TagAllocatorBase {
   public:
-    virtual ~TagAllocatorBase() { cleanUpResources(); };
+    virtual ~TagAllocatorBase();
 
     virtual void returnTag(TagNodeBase *node) = 0;
 
@@ -159,6 +162,7 @@ class TagAllocatorBase {
 
     void cleanUpResources();
 
+    const uint64_t allocatorId;
     std::vector<std::unique_ptr<MultiGraphicsAllocation>> gfxAllocations;
     const DeviceBitfield deviceBitfield;
     RootDeviceIndicesContainer rootDeviceIndices;
@@ -194,11 +198,26 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    // Magazine of free nodes accessed only by its owning thread, refilled from and released to freeTags in batches,
+    // so getTag/returnTag take no lock in steady state. usedTags is not maintained for cached nodes.
+    struct ThreadCache {
+        IDList<NodeType, false> tags;
+        size_t numTags = 0;
+        std::shared_ptr<std::atomic<bool>> threadAlive;
+    };
+
+    ThreadCache &getThreadCache();
+    NodeType *getTagFromThreadCache();
+    void returnTagToThreadCache(NodeType *node);
+    void reclaimThreadCachesOfExitedThreadsLocked();
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
+    std::unordered_map<uint64_t, std::unique_ptr<ThreadCache>> threadCaches;
+    size_t threadCacheBatchSize = 0;
 
     bool initializeTags = true;
 };
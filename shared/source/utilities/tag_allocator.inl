@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/thread_cache_registry.h"
 
 namespace NEO {
 template <typename TagType>
@@ -16,21 +17,30 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
                                     size_t tagSize, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), initializeTags(initializeTags) {
 
+    if (debugManager.flags.TagAllocatorThreadCacheBatchSize.get() > 0) {
+        threadCacheBatchSize = static_cast<size_t>(debugManager.flags.TagAllocatorThreadCacheBatchSize.get());
+    }
+
     populateFreeTags();
 }
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
-    if (freeTags.peekIsEmpty()) {
-        releaseDeferredTags();
-    }
-    auto node = freeTags.removeFrontOne().release();
-    if (!node) {
-        std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
+    NodeType *node = nullptr;
+    if (threadCacheBatchSize > 0) {
+        node = getTagFromThreadCache();
+    } else {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
         node = freeTags.removeFrontOne().release();
+        if (!node) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            populateFreeTags();
+            node = freeTags.removeFrontOne().release();
+        }
+        usedTags.pushFrontOne(*node);
     }
-    usedTags.pushFrontOne(*node);
     node->incRefCount();
 
     if (initializeTags) {
@@ -44,25 +54,112 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
     return node;
 }
 
+template <typename TagType>
+typename TagAllocator<TagType>::ThreadCache &TagAllocator<TagType>::getThreadCache() {
+    auto threadCache = static_cast<ThreadCache *>(ThreadCacheRegistry::getThreadCache(this->allocatorId));
+    if (threadCache) {
+        return *threadCache;
+    }
+    {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        auto &threadCacheEntry = threadCaches[ThreadCacheRegistry::getThreadToken()];
+        if (!threadCacheEntry) {
+            threadCacheEntry = std::make_unique<ThreadCache>();
+            threadCacheEntry->threadAlive = ThreadCacheRegistry::getThreadAliveFlag();
+        }
+        threadCache = threadCacheEntry.get();
+    }
+    ThreadCacheRegistry::setThreadCache(this->allocatorId, threadCache);
+    return *threadCache;
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getTagFromThreadCache() {
+    auto &threadCache = getThreadCache();
+
+    if (threadCache.numTags == 0) {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        size_t count = threadCacheBatchSize;
+        auto nodes = freeTags.detachFrontNodes(count);
+        if (!nodes) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            reclaimThreadCachesOfExitedThreadsLocked();
+            count = threadCacheBatchSize;
+            nodes = freeTags.detachFrontNodes(count);
+            if (!nodes) {
+                populateFreeTags();
+                count = threadCacheBatchSize;
+                nodes = freeTags.detachFrontNodes(count);
+            }
+        }
+        threadCache.tags.splice(*nodes);
+        threadCache.numTags = count;
+    }
+
+    threadCache.numTags--;
+    return threadCache.tags.removeFrontOne().release();
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::returnTagToThreadCache(NodeType *node) {
+    auto &threadCache = getThreadCache();
+    threadCache.tags.pushFrontOne(*node);
+    threadCache.numTags++;
+
+    // cache holds at most two batches, surplus batch goes back to shared pool
+    if (threadCache.numTags > 2 * threadCacheBatchSize) {
+        size_t count = threadCacheBatchSize;
+        auto nodesToRelease = threadCache.tags.detachFrontNodes(count);
+        threadCache.numTags -= count;
+        freeTags.splice(*nodesToRelease);
+    }
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::reclaimThreadCachesOfExitedThreadsLocked() {
+    auto threadCacheIt = threadCaches.begin();
+    while (threadCacheIt != threadCaches.end()) {
+        auto &threadCache = *threadCacheIt->second;
+        if (threadCache.threadAlive->load()) {
+            ++threadCacheIt;
+            continue;
+        }
+        if (!threadCache.tags.peekIsEmpty()) {
+            freeTags.splice(*threadCache.tags.detachNodes());
+        }
+        threadCacheIt = threadCaches.erase(threadCacheIt);
+    }
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
 
     if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
+    if (threadCacheBatchSize > 0) {
+        returnTagToThreadCache(nodeT);
+        return;
+    }
+
+    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+    DEBUG_BREAK_IF(usedNode == nullptr);
+
     freeTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    if (threadCacheBatchSize == 0) {
+        [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+        DEBUG_BREAK_IF(!usedNode);
+    }
+    deferredTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
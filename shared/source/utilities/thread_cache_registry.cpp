@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_cache_registry.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> ownerIdCounter{0u};
+std::atomic<uint64_t> threadTokenCounter{0u};
+
+std::mutex ownersMutex;
+std::unordered_set<uint64_t> ownersWithThreadCaches;
+std::vector<uint64_t> unregisteredOwners;
+std::atomic<size_t> unregisteredOwnersCount{0u};
+
+// thread ids can be reused, token is unique for thread lifetime and alive flag lets owners reclaim caches of exited threads
+struct ThreadState {
+    ThreadState() : token(++threadTokenCounter), alive(std::make_shared<std::atomic<bool>>(true)), unregisteredOwnersSeen(unregisteredOwnersCount.load()) {}
+    ~ThreadState() {
+        alive->store(false);
+    }
+    uint64_t token;
+    std::shared_ptr<std::atomic<bool>> alive;
+    std::unordered_map<uint64_t, void *> threadCaches;
+    size_t unregisteredOwnersSeen;
+};
+thread_local ThreadState threadState;
+
+void eraseCachesOfUnregisteredOwners() {
+    if (threadState.unregisteredOwnersSeen == unregisteredOwnersCount.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(ownersMutex);
+    for (auto i = threadState.unregisteredOwnersSeen; i < unregisteredOwners.size(); i++) {
+        threadState.threadCaches.erase(unregisteredOwners[i]);
+    }
+    threadState.unregisteredOwnersSeen = unregisteredOwners.size();
+}
+} // namespace
+
+uint64_t ThreadCacheRegistry::registerOwner() {
+    return ++ownerIdCounter;
+}
+
+void ThreadCacheRegistry::unregisterOwner(uint64_t ownerId) {
+    std::lock_guard<std::mutex> lock(ownersMutex);
+    if (ownersWithThreadCaches.erase(ownerId) == 0u) {
+        return;
+    }
+    unregisteredOwners.push_back(ownerId);
+    unregisteredOwnersCount.store(unregisteredOwners.size(), std::memory_order_release);
+}
+
+void *ThreadCacheRegistry::getThreadCache(uint64_t ownerId) {
+    eraseCachesOfUnregisteredOwners();
+    auto threadCache = threadState.threadCaches.find(ownerId);
+    return threadCache != threadState.threadCaches.end() ? threadCache->second : nullptr;
+}
+
+void ThreadCacheRegistry::setThreadCache(uint64_t ownerId, void *threadCache) {
+    {
+        std::lock_guard<std::mutex> lock(ownersMutex);
+        ownersWithThreadCaches.insert(ownerId);
+    }
+    threadState.threadCaches[ownerId] = threadCache;
+}
+
+uint64_t ThreadCacheRegistry::getThreadToken() {
+    return threadState.token;
+}
+
+const std::shared_ptr<std::atomic<bool>> &ThreadCacheRegistry::getThreadAliveFlag() {
+    return threadState.alive;
+}
+
+} // namespace NEO
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+// Per thread lookup of caches which long lived owners (allocators, pools) keep for each calling thread.
+// Lookup takes no lock: every thread has its own map keyed by owner id. Owner ids are never reused, so entries
+// of an unregistered owner are never returned and each thread erases them on its next lookup.
+// Caches themselves stay owned by their owner, thread token and alive flag let owner reclaim caches of exited threads.
+class ThreadCacheRegistry {
+  public:
+    static uint64_t registerOwner();
+    static void unregisterOwner(uint64_t ownerId);
+
+    static void *getThreadCache(uint64_t ownerId);
+    static void setThreadCache(uint64_t ownerId, void *threadCache);
+
+    static uint64_t getThreadToken();
+    static const std::shared_ptr<std::atomic<bool>> &getThreadAliveFlag();
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@ void CpuInfo::detect() const {
     constexpr size_t edx = 3;
 
     uint32_t cpuInfo[4] = {};
+    bool avx512StateEnabled = false;
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[eax];
@@ -31,6 +32,12 @@ void CpuInfo::detect() const {
         cpuid(cpuInfo, processorInfo);
         {
             features |= cpuInfo[edx] & BIT(19) ? featureClflush : featureNone;
+
+            // OS has to save SSE, AVX, opmask and upper ZMM state on context switch
+            if (cpuInfo[ecx] & BIT(27)) {
+                constexpr uint64_t avx512StateMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+                avx512StateEnabled = (xgetbvFunc(0u) & avx512StateMask) == avx512StateMask;
+            }
         }
     }
 
@@ -40,6 +47,9 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[ebx] & mask) == mask ? featureAvX2 : featureNone;
 
+            auto avx512Mask = BIT(16) | BIT(30);
+            features |= avx512StateEnabled && (cpuInfo[ebx] & avx512Mask) == avx512Mask ? featureAvX512 : featureNone;
+
             features |= (cpuInfo[ecx] & BIT(5)) ? featureWaitPkg : featureNone;
         }
     }
@@ -53,7 +63,7 @@ void CpuInfo::detect() const {
         }
     }
     if (debugManager.flags.PrintCpuFlags.get()) {
-        printf("CPUFlags:\nCLFlush: %d Avx2: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureWaitPkg), virtualAddressSize);
+        printf("CPUFlags:\nCLFlush: %d Avx2: %d Avx512: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureAvX512), !!(features & featureWaitPkg), virtualAddressSize);
     }
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@ struct WhiteBox<NEO::Linker> : NEO::Linker {
     using BaseClass::patchDataSegments;
     using BaseClass::patchInstructionsSegments;
     using BaseClass::relocatedSymbols;
+    using BaseClass::relocatedSymbolsById;
     using BaseClass::relocateSymbols;
     using BaseClass::resolveExternalFunctions;
 };
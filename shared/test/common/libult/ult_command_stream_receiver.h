@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -151,6 +151,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::CommandStreamReceiver::requestedPreallocationsAmount;
     using BaseClass::CommandStreamReceiver::requiredScratchSlot0Size;
     using BaseClass::CommandStreamReceiver::requiredScratchSlot1Size;
+    using BaseClass::CommandStreamReceiver::residencyGeneration;
     using BaseClass::CommandStreamReceiver::resourcesInitialized;
     using BaseClass::CommandStreamReceiver::samplerCacheFlushRequired;
     using BaseClass::CommandStreamReceiver::sbaSupportFlags;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,8 @@ class MockIoctlHelper : public IoctlHelperPrelim20 {
 
     ADDMETHOD_NOBASE(vmBind, int, 0, (const VmBindParams &));
     ADDMETHOD_NOBASE(vmUnbind, int, 0, (const VmBindParams &));
+    ADDMETHOD_CONST_NOBASE(isVmBindBatchSupported, bool, false, ());
+    ADDMETHOD_NOBASE(vmBindBatch, int, 0, (const std::vector<VmBindParams> &, bool));
     ADDMETHOD_NOBASE(allocateInterrupt, bool, true, (uint32_t &));
     ADDMETHOD_NOBASE(createMediaContext, bool, true, (uint32_t, void *, uint32_t, void *, uint32_t, void *&));
     ADDMETHOD_NOBASE(releaseMediaContext, bool, true, (void *));
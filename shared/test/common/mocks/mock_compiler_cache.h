@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,7 +12,9 @@
 namespace NEO {
 class CompilerCacheMock : public CompilerCache {
   public:
+    using CompilerCache::asyncWriter;
     using CompilerCache::config;
+    using CompilerCache::memoryTier;
 
     CompilerCacheMock() : CompilerCache(CompilerCacheConfig{}) {
     }
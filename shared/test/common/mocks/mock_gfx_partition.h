@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,7 +68,7 @@ class MockGfxPartition : public GfxPartition {
         }
     }
     void initHeap(HeapIndex heapIndex, uint64_t base, uint64_t size, size_t allocationAlignment) {
-        getHeap(heapIndex).init(base, size, allocationAlignment);
+        getHeap(heapIndex).init(base, size, allocationAlignment, isSegregatedFitHeap(heapIndex));
     }
 
     uint32_t freeGpuAddressRangeCalled = 0u;
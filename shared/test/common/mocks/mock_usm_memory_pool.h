@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,8 @@ class MockUsmMemAllocPool : public UsmMemAllocPool {
     using UsmMemAllocPool::poolEnd;
     using UsmMemAllocPool::poolMemoryType;
     using UsmMemAllocPool::poolSize;
+    using UsmMemAllocPool::slabAllocationsCount;
+    using UsmMemAllocPool::threadCacheEnabled;
 };
 
 class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <optional>
 
 using NEO::Drm;
 using NEO::DrmIoctl;
@@ -202,6 +203,9 @@ struct DrmMockCustom : public Drm {
 
     bool checkResetStatus(OsContext &osContext) override {
         checkResetStatusCalled++;
+        if (checkResetStatusReturnValue.has_value()) {
+            return *checkResetStatusReturnValue;
+        }
         return Drm::checkResetStatus(osContext);
     }
 
@@ -219,6 +223,7 @@ struct DrmMockCustom : public Drm {
     IsChunkingAvailableCall isChunkingAvailableCall{};
 
     size_t checkResetStatusCalled = 0u;
+    std::optional<bool> checkResetStatusReturnValue{};
 
     std::atomic<int> ioctlRes;
     std::atomic<IoctlResExt *> ioctlResExt;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,7 @@ int mkstempCalled = 0;
 int renameCalled = 0;
 int pathFileExistsCalled = 0;
 int flockCalled = 0;
+int ftruncateCalled = 0;
 int opendirCalled = 0;
 int readdirCalled = 0;
 int closedirCalled = 0;
@@ -99,6 +100,7 @@ int (*sysCallsScandir)(const char *dirp,
 int (*sysCallsUnlink)(const std::string &pathname) = nullptr;
 int (*sysCallsStat)(const std::string &filePath, struct stat *statbuf) = nullptr;
 int (*sysCallsMkstemp)(char *fileName) = nullptr;
+int (*sysCallsFtruncate)(int fd, off_t length) = nullptr;
 int (*sysCallsMkdir)(const std::string &dir) = nullptr;
 DIR *(*sysCallsOpendir)(const char *name) = nullptr;
 struct dirent *(*sysCallsReaddir)(DIR *dir) = nullptr;
@@ -410,6 +412,17 @@ int flock(int fd, int flag) {
 
     return -1;
 }
+
+int ftruncate(int fd, off_t length) {
+    ftruncateCalled++;
+
+    if (sysCallsFtruncate != nullptr) {
+        return sysCallsFtruncate(fd, length);
+    }
+
+    return 0;
+}
+
 int rename(const char *currName, const char *dstName) {
     renameCalled++;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,7 @@ extern int (*sysCallsScandir)(const char *dirp,
 extern int (*sysCallsUnlink)(const std::string &pathname);
 extern int (*sysCallsStat)(const std::string &filePath, struct stat *statbuf);
 extern int (*sysCallsMkstemp)(char *fileName);
+extern int (*sysCallsFtruncate)(int fd, off_t length);
 extern bool (*sysCallsPathExists)(const std::string &path);
 extern DIR *(*sysCallsOpendir)(const char *name);
 extern struct dirent *(*sysCallsReaddir)(DIR *dir);
@@ -70,6 +71,7 @@ extern int mkstempCalled;
 extern int renameCalled;
 extern int pathFileExistsCalled;
 extern int flockCalled;
+extern int ftruncateCalled;
 extern int fsyncCalled;
 extern int fsyncArgPassed;
 extern int fsyncRetVal;
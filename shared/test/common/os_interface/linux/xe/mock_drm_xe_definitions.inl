@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -140,6 +140,10 @@ int DrmMockXe::ioctl(DrmIoctl request, void *arg) {
         ret = gemVmBindReturn;
         auto vmBindInput = static_cast<drm_xe_vm_bind *>(arg);
         vmBindInputs.push_back(*vmBindInput);
+        if (vmBindInput->num_binds > 1) {
+            auto bindOps = reinterpret_cast<drm_xe_vm_bind_op *>(vmBindInput->vector_of_binds);
+            vmBindOpsInputs.insert(vmBindOpsInputs.end(), bindOps, bindOps + vmBindInput->num_binds);
+        }
 
         if (vmBindInput->num_syncs == 1) {
             auto &syncInput = reinterpret_cast<drm_xe_sync *>(vmBindInput->syncs)[0];
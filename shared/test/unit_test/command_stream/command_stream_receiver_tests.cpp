@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -5623,6 +5623,43 @@ HWTEST_F(CommandStreamReceiverTest, givenCsrWhenMakeResidentCalledThenUpdateTask
     EXPECT_NE(updatedTaskCount, initialAllocTaskCount);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenIncrementalResidencyWhenMakeResidentCalledForAllocationResidentAtCurrentGenerationThenOnlyTaskCountsAreUpdated) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto contextId = csr.getOsContext().getContextId();
+    std::atomic<uint32_t> residencyGeneration{5u};
+    csr.residencyGeneration = &residencyGeneration;
+    csr.getResidencyAllocations().clear();
+
+    MockGraphicsAllocation residentAllocation;
+    MockGraphicsAllocation newAllocation;
+    residentAllocation.setResidencyGeneration(5u, contextId);
+    newAllocation.setResidencyGeneration(4u, contextId);
+
+    csr.makeResident(residentAllocation);
+    csr.makeResident(newAllocation);
+
+    ASSERT_EQ(1u, csr.getResidencyAllocations().size());
+    EXPECT_EQ(&newAllocation, csr.getResidencyAllocations()[0]);
+    ASSERT_EQ(1u, csr.getGenerationResidentAllocations().size());
+    EXPECT_EQ(&residentAllocation, csr.getGenerationResidentAllocations()[0]);
+    EXPECT_EQ(csr.peekTaskCount() + 1, residentAllocation.getTaskCount(contextId));
+    EXPECT_EQ(csr.peekTaskCount() + 1, residentAllocation.getResidencyTaskCount(contextId));
+    EXPECT_EQ(csr.peekTaskCount() + 1, newAllocation.getTaskCount(contextId));
+
+    csr.makeSurfacePackNonResident(csr.getResidencyAllocations(), true);
+    EXPECT_FALSE(residentAllocation.isResident(contextId));
+    EXPECT_TRUE(csr.getGenerationResidentAllocations().empty());
+
+    residencyGeneration++;
+    csr.taskCount++;
+    csr.makeResident(residentAllocation);
+    ASSERT_EQ(1u, csr.getResidencyAllocations().size());
+    EXPECT_EQ(&residentAllocation, csr.getResidencyAllocations()[0]);
+
+    csr.makeSurfacePackNonResident(csr.getResidencyAllocations(), true);
+    csr.residencyGeneration = nullptr;
+}
+
 using CommandStreamReceiverHwHeaplessTest = Test<DeviceFixture>;
 
 HWTEST_F(CommandStreamReceiverHwHeaplessTest, whenHeaplessCommandStreamReceiverFunctionsAreCalledThenExceptionIsThrown) {
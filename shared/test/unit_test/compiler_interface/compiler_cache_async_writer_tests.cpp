@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_async_writer.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+class WriteRecordingCompilerCache : public CompilerCache {
+  public:
+    WriteRecordingCompilerCache() : CompilerCache(CompilerCacheConfig{}) {}
+
+    bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override {
+        while (blockWrites.load()) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(writtenMutex);
+        written.push_back(kernelFileHash);
+        return true;
+    }
+
+    size_t getNumWrites(const std::string &kernelFileHash) {
+        std::lock_guard<std::mutex> lock(writtenMutex);
+        return static_cast<size_t>(std::count(written.begin(), written.end(), kernelFileHash));
+    }
+
+    size_t getNumWrites() {
+        std::lock_guard<std::mutex> lock(writtenMutex);
+        return written.size();
+    }
+
+    std::atomic<bool> blockWrites{false};
+    std::mutex writtenMutex;
+    std::vector<std::string> written;
+};
+
+CachedBinaryView makeBinary(size_t size) {
+    auto data = std::make_unique<char[]>(size);
+    memset(data.get(), 'x', size);
+    return CompilerCacheMemoryTier::makeView(std::move(data), size);
+}
+} // namespace
+
+TEST(CompilerCacheAsyncWriterTest, givenQueuedBinariesWhenFlushingThenAllBinariesAreWrittenByWorker) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, MemoryConstants::megaByte);
+    EXPECT_TRUE(writer.isWorkerActive());
+
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+    EXPECT_TRUE(writer.enqueue("hash1", makeBinary(16)));
+    EXPECT_TRUE(writer.enqueue("hash2", makeBinary(16)));
+    writer.flush();
+
+    EXPECT_EQ(3u, cache.getNumWrites());
+    EXPECT_EQ(0u, writer.getQueuedSize());
+    EXPECT_EQ(nullptr, writer.findPending("hash0"));
+    EXPECT_LE(1u, writer.getNumBatchesWritten());
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenNullOrEmptyBinaryWhenEnqueueThenFalseIsReturned) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, MemoryConstants::megaByte);
+
+    EXPECT_FALSE(writer.enqueue("hash0", nullptr));
+    EXPECT_FALSE(writer.enqueue("hash0", CompilerCacheMemoryTier::makeView(nullptr, 0u)));
+    writer.flush();
+    EXPECT_EQ(0u, cache.getNumWrites());
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenBinaryPendingWriteWhenFindingOrEnqueueingAgainThenPendingBinaryIsReturnedAndWrittenOnce) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, MemoryConstants::megaByte);
+
+    cache.blockWrites = true;
+    auto binary = makeBinary(16);
+    EXPECT_TRUE(writer.enqueue("hash0", binary));
+    EXPECT_EQ(binary, writer.findPending("hash0"));
+    EXPECT_EQ(nullptr, writer.findPending("hash1"));
+
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+    EXPECT_TRUE(writer.enqueue("hash1", makeBinary(16)));
+    EXPECT_EQ(32u, writer.getQueuedSize());
+
+    cache.blockWrites = false;
+    writer.flush();
+
+    EXPECT_EQ(1u, cache.getNumWrites("hash0"));
+    EXPECT_EQ(1u, cache.getNumWrites("hash1"));
+    EXPECT_EQ(nullptr, writer.findPending("hash0"));
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenQueueLimitReachedWhenEnqueueThenQueuedSizeDoesNotExceedLimitAndAllBinariesAreWritten) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, 16u);
+
+    cache.blockWrites = true;
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+
+    std::thread producer([&writer]() {
+        EXPECT_TRUE(writer.enqueue("hash1", makeBinary(16)));
+    });
+    EXPECT_EQ(16u, writer.getQueuedSize());
+
+    cache.blockWrites = false;
+    producer.join();
+    writer.flush();
+
+    EXPECT_EQ(2u, cache.getNumWrites());
+    EXPECT_EQ(0u, writer.getQueuedSize());
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenBinaryBiggerThanQueueLimitWhenEnqueueThenBinaryIsWrittenSynchronously) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, 8u);
+
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+    EXPECT_EQ(1u, cache.getNumWrites("hash0"));
+    EXPECT_EQ(0u, writer.getQueuedSize());
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenWorkerThreadNotCreatedWhenEnqueueThenBinaryIsWrittenSynchronously) {
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, MemoryConstants::megaByte);
+    EXPECT_FALSE(writer.isWorkerActive());
+
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+    EXPECT_EQ(1u, cache.getNumWrites("hash0"));
+    EXPECT_EQ(nullptr, writer.findPending("hash0"));
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenQueuedBinariesWhenWriterIsStoppedThenAllBinariesAreWrittenAndNextBinariesAreWrittenSynchronously) {
+    WriteRecordingCompilerCache cache;
+    CompilerCacheAsyncWriter writer(cache, MemoryConstants::megaByte);
+
+    EXPECT_TRUE(writer.enqueue("hash0", makeBinary(16)));
+    EXPECT_TRUE(writer.enqueue("hash1", makeBinary(16)));
+    writer.stop();
+
+    EXPECT_FALSE(writer.isWorkerActive());
+    EXPECT_EQ(2u, cache.getNumWrites());
+
+    EXPECT_TRUE(writer.enqueue("hash2", makeBinary(16)));
+    EXPECT_EQ(1u, cache.getNumWrites("hash2"));
+}
+
+TEST(CompilerCacheAsyncWriterTest, givenAsyncWritebackEnabledInConfigWhenCreatingCompilerCacheThenWriterIsCreated) {
+    CompilerCacheConfig config = {};
+    config.enabled = true;
+    config.asyncWriteback = true;
+    CompilerCache cache(config);
+    ASSERT_NE(nullptr, cache.getAsyncWriter());
+    EXPECT_TRUE(cache.getAsyncWriter()->isWorkerActive());
+
+    config.enabled = false;
+    CompilerCache disabledCache(config);
+    EXPECT_EQ(nullptr, disabledCache.getAsyncWriter());
+
+    config.enabled = true;
+    config.asyncWriteback = false;
+    CompilerCache syncCache(config);
+    EXPECT_EQ(nullptr, syncCache.getAsyncWriter());
+}
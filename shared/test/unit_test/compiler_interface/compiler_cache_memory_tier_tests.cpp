@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+
+using namespace NEO;
+
+namespace {
+CachedBinaryView makeBinary(const std::string &contents) {
+    return CompilerCacheMemoryTier::makeView(makeCopy<char>(contents.c_str(), contents.size()), contents.size());
+}
+} // namespace
+
+TEST(CompilerCacheMemoryTierTest, givenEmptyTierWhenFindingBinaryThenMissIsCounted) {
+    CompilerCacheMemoryTier memoryTier(1024u);
+    EXPECT_EQ(nullptr, memoryTier.find("hash"));
+
+    auto stats = memoryTier.getStats();
+    EXPECT_EQ(0u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(0u, stats.evictions);
+    EXPECT_EQ(0u, stats.numEntries);
+    EXPECT_EQ(0u, stats.usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTest, givenInsertedBinaryWhenFindingThenSameSharedBinaryIsReturned) {
+    CompilerCacheMemoryTier memoryTier(1024u);
+    auto binary = makeBinary("binary");
+    memoryTier.insert("hash", binary);
+
+    auto found = memoryTier.find("hash");
+    EXPECT_EQ(binary.get(), found.get());
+    EXPECT_EQ(0, memcmp("binary", found->get().begin(), found->size));
+
+    auto stats = memoryTier.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(0u, stats.misses);
+    EXPECT_EQ(1u, stats.numEntries);
+    EXPECT_EQ(binary->size, stats.usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTest, givenEmptyOrTooBigBinaryWhenInsertingThenBinaryIsNotStored) {
+    CompilerCacheMemoryTier memoryTier(4u);
+    memoryTier.insert("hash0", nullptr);
+    memoryTier.insert("hash1", makeBinary(""));
+    memoryTier.insert("hash2", makeBinary("12345"));
+
+    EXPECT_EQ(0u, memoryTier.getStats().numEntries);
+}
+
+TEST(CompilerCacheMemoryTierTest, givenAlreadyInsertedHashWhenInsertingAgainThenFirstBinaryIsKept) {
+    CompilerCacheMemoryTier memoryTier(1024u);
+    auto binary = makeBinary("binary");
+    memoryTier.insert("hash", binary);
+    memoryTier.insert("hash", makeBinary("other"));
+
+    EXPECT_EQ(binary.get(), memoryTier.find("hash").get());
+    EXPECT_EQ(1u, memoryTier.getStats().numEntries);
+    EXPECT_EQ(binary->size, memoryTier.getStats().usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTest, givenFullTierWhenInsertingThenLeastRecentlyUsedBinariesAreEvicted) {
+    CompilerCacheMemoryTier memoryTier(12u);
+    memoryTier.insert("hash0", makeBinary("0000"));
+    memoryTier.insert("hash1", makeBinary("1111"));
+    memoryTier.insert("hash2", makeBinary("2222"));
+
+    EXPECT_NE(nullptr, memoryTier.find("hash0"));
+
+    memoryTier.insert("hash3", makeBinary("3333"));
+
+    EXPECT_NE(nullptr, memoryTier.find("hash0"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash1"));
+    EXPECT_NE(nullptr, memoryTier.find("hash2"));
+    EXPECT_NE(nullptr, memoryTier.find("hash3"));
+
+    memoryTier.insert("hash4", makeBinary("44444444"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash2"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash0"));
+    EXPECT_NE(nullptr, memoryTier.find("hash4"));
+
+    auto stats = memoryTier.getStats();
+    EXPECT_EQ(3u, stats.evictions);
+    EXPECT_EQ(2u, stats.numEntries);
+    EXPECT_EQ(12u, stats.usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTest, givenEvictedBinaryStillInUseWhenEvictingThenBinaryRemainsValid) {
+    CompilerCacheMemoryTier memoryTier(4u);
+    memoryTier.insert("hash0", makeBinary("0000"));
+    auto inUse = memoryTier.find("hash0");
+
+    memoryTier.insert("hash1", makeBinary("1111"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash0"));
+    EXPECT_EQ(0, memcmp("0000", inUse->data.get(), inUse->size));
+}
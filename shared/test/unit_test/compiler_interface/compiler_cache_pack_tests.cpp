@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+class MockCompilerCachePack : public CompilerCachePack {
+  public:
+    using CompilerCachePack::entries;
+    using CompilerCachePack::header;
+};
+
+struct CompilerCachePackTest : public ::testing::Test {
+    void SetUp() override {
+        packSize = CompilerCachePack::getMinimalPackSize();
+        packMemory = alignedMalloc(packSize, MemoryConstants::pageSize);
+        memset(packMemory, 0, packSize);
+        ASSERT_TRUE(pack.initialize(packMemory, packSize));
+    }
+
+    void TearDown() override {
+        alignedFree(packMemory);
+    }
+
+    std::string getKey(uint32_t index) {
+        return "0123456789abcdef" + std::to_string(index);
+    }
+
+    MockCompilerCachePack pack;
+    void *packMemory = nullptr;
+    size_t packSize = 0u;
+};
+
+TEST_F(CompilerCachePackTest, givenTooSmallOrMisalignedMemoryWhenInitializingThenFailureIsReturned) {
+    CompilerCachePack otherPack;
+    EXPECT_FALSE(otherPack.initialize(nullptr, packSize));
+    EXPECT_FALSE(otherPack.initialize(packMemory, packSize - 1));
+    EXPECT_FALSE(otherPack.initialize(ptrOffset(packMemory, 8), packSize - 64));
+    EXPECT_FALSE(otherPack.isInitialized());
+}
+
+TEST_F(CompilerCachePackTest, givenEmptyMemoryWhenInitializingThenPackIsFormatted) {
+    EXPECT_TRUE(pack.isInitialized());
+    EXPECT_EQ(CompilerCachePack::packMagic, pack.header->magic);
+    EXPECT_EQ(CompilerCachePack::packVersion, pack.header->version);
+    EXPECT_EQ(packSize, pack.header->packSize);
+    EXPECT_EQ(CompilerCachePack::minNumSets, pack.header->numSets);
+    EXPECT_EQ(pack.header->numSets * CompilerCachePack::waysPerSet, pack.getNumEntries());
+    EXPECT_EQ(packSize - pack.header->dataOffset, pack.getDataCapacity());
+    EXPECT_EQ(0u, pack.header->writeOffset.load());
+}
+
+TEST_F(CompilerCachePackTest, givenStoredBinaryWhenLoadingThenSameBinaryIsReturned) {
+    const std::vector<char> binary(1000, 'x');
+    EXPECT_TRUE(pack.store(getKey(0), binary.data(), binary.size()));
+
+    size_t loadedSize = 0u;
+    auto loaded = pack.load(getKey(0), loadedSize);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(binary.size(), loadedSize);
+    EXPECT_EQ(0, memcmp(binary.data(), loaded.get(), loadedSize));
+
+    loaded = pack.load(getKey(1), loadedSize);
+    EXPECT_EQ(nullptr, loaded);
+    EXPECT_EQ(0u, loadedSize);
+}
+
+TEST_F(CompilerCachePackTest, givenInvalidInputWhenStoringThenFailureIsReturned) {
+    const char binary[] = "binary";
+    EXPECT_FALSE(pack.store(getKey(0), nullptr, sizeof(binary)));
+    EXPECT_FALSE(pack.store(getKey(0), binary, 0u));
+    EXPECT_FALSE(pack.store("", binary, sizeof(binary)));
+    EXPECT_FALSE(pack.store(std::string(CompilerCachePack::maxKeyLength, 'a'), binary, sizeof(binary)));
+
+    std::vector<char> tooBigBinary(static_cast<size_t>(pack.getDataCapacity()), 'x');
+    EXPECT_FALSE(pack.store(getKey(0), tooBigBinary.data(), tooBigBinary.size()));
+}
+
+TEST_F(CompilerCachePackTest, givenAlreadyStoredKeyWhenStoringAgainThenNoDataIsAppended) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(pack.store(getKey(0), binary, sizeof(binary)));
+    auto writeOffset = pack.header->writeOffset.load();
+
+    EXPECT_TRUE(pack.store(getKey(0), binary, sizeof(binary)));
+    EXPECT_EQ(writeOffset, pack.header->writeOffset.load());
+}
+
+TEST_F(CompilerCachePackTest, givenFullDataLogWhenStoringThenOldestBinariesAreEvicted) {
+    std::vector<char> binary(static_cast<size_t>(pack.getDataCapacity() / 4), 'x');
+    constexpr uint32_t numBinaries = 12u;
+    for (uint32_t i = 0; i < numBinaries; i++) {
+        binary[0] = static_cast<char>(i);
+        EXPECT_TRUE(pack.store(getKey(i), binary.data(), binary.size()));
+    }
+
+    size_t loadedSize = 0u;
+    EXPECT_EQ(nullptr, pack.load(getKey(0), loadedSize));
+    EXPECT_EQ(nullptr, pack.load(getKey(numBinaries - 4), loadedSize));
+
+    for (uint32_t i = numBinaries - 3; i < numBinaries; i++) {
+        auto loaded = pack.load(getKey(i), loadedSize);
+        ASSERT_NE(nullptr, loaded);
+        EXPECT_EQ(static_cast<char>(i), loaded[0]);
+    }
+}
+
+TEST_F(CompilerCachePackTest, givenFullIndexSetWhenStoringThenLeastRecentlyUsedEntryIsReplaced) {
+    const char binary[] = "binary";
+    std::vector<std::string> keysInSet;
+    for (uint32_t i = 0; keysInSet.size() < CompilerCachePack::waysPerSet + 1; i++) {
+        auto key = getKey(i);
+        if ((Hash::hash(key.c_str(), key.size()) & (pack.header->numSets - 1)) == 0u) {
+            keysInSet.push_back(key);
+        }
+    }
+
+    for (uint32_t i = 0; i < CompilerCachePack::waysPerSet; i++) {
+        EXPECT_TRUE(pack.store(keysInSet[i], binary, sizeof(binary)));
+    }
+
+    size_t loadedSize = 0u;
+    EXPECT_NE(nullptr, pack.load(keysInSet[0], loadedSize));
+
+    EXPECT_TRUE(pack.store(keysInSet[CompilerCachePack::waysPerSet], binary, sizeof(binary)));
+
+    EXPECT_NE(nullptr, pack.load(keysInSet[0], loadedSize));
+    EXPECT_EQ(nullptr, pack.load(keysInSet[1], loadedSize));
+    for (uint32_t i = 2; i <= CompilerCachePack::waysPerSet; i++) {
+        EXPECT_NE(nullptr, pack.load(keysInSet[i], loadedSize));
+    }
+}
+
+TEST_F(CompilerCachePackTest, givenEntryBeingModifiedWhenLoadingThenMissIsReturned) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(pack.store(getKey(0), binary, sizeof(binary)));
+
+    CompilerCachePack::IndexEntry *entry = nullptr;
+    for (uint32_t i = 0; i < pack.getNumEntries(); i++) {
+        if (pack.entries[i].size != 0) {
+            entry = &pack.entries[i];
+        }
+    }
+    ASSERT_NE(nullptr, entry);
+
+    entry->sequence.fetch_add(1u);
+    size_t loadedSize = 0u;
+    EXPECT_EQ(nullptr, pack.load(getKey(0), loadedSize));
+
+    entry->sequence.fetch_add(1u);
+    EXPECT_NE(nullptr, pack.load(getKey(0), loadedSize));
+}
+
+TEST_F(CompilerCachePackTest, givenPackInitializedOnExistingMemoryThenStoredBinariesArePreserved) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(pack.store(getKey(0), binary, sizeof(binary)));
+
+    CompilerCachePack otherPack;
+    ASSERT_TRUE(otherPack.initialize(packMemory, packSize));
+
+    size_t loadedSize = 0u;
+    auto loaded = otherPack.load(getKey(0), loadedSize);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), loadedSize);
+}
+
+TEST_F(CompilerCachePackTest, givenCorruptedHeaderWhenInitializingThenPackIsReformatted) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(pack.store(getKey(0), binary, sizeof(binary)));
+
+    pack.header->version = CompilerCachePack::packVersion + 1;
+
+    CompilerCachePack otherPack;
+    ASSERT_TRUE(otherPack.initialize(packMemory, packSize));
+
+    size_t loadedSize = 0u;
+    EXPECT_EQ(nullptr, otherPack.load(getKey(0), loadedSize));
+    EXPECT_EQ(CompilerCachePack::packVersion, pack.header->version);
+}
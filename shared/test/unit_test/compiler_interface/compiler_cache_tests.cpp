@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -270,6 +270,31 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, GivenPrecomputedHwInfoDigestWhenGettingCacheFileNameThenSameHashAsForHwInfoIsReturned) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel void k(){}";
+    CompilerCache cache(CompilerCacheConfig{});
+
+    const auto digest = CompilerCache::getHwInfoDigest(hwInfo);
+    EXPECT_EQ(digest, CompilerCache::getHwInfoDigest(hwInfo));
+
+    auto hash = cache.getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src)), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), 0u, 0);
+    auto hashFromDigest = cache.getCachedFileName(hwInfo, digest, ArrayRef<const char>(src, sizeof(src)), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), 0u, 0);
+    EXPECT_EQ(hash, hashFromDigest);
+
+    hwInfo.platform.usRevId++;
+    EXPECT_NE(digest, CompilerCache::getHwInfoDigest(hwInfo));
+}
+
+TEST(CompilerCacheHashTests, WhenGettingCacheFileNameThenFixedLength128BitHexStringIsReturned) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel void k(){}";
+    CompilerCache cache(CompilerCacheConfig{});
+    auto hash = cache.getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src)), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), 0u, 0);
+    EXPECT_EQ(32u, hash.size());
+    EXPECT_EQ(std::string::npos, hash.find_first_not_of("0123456789abcdef"));
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     debugManager.flags.BinaryCacheTrace.set(true);
@@ -634,6 +659,79 @@ TEST_F(CompilerInterfaceOclElfCacheTest, givenNonEmptyTranslationOutputWhenProce
     EXPECT_EQ(0, memcmp(nonEmptyTranslationOutput.intermediateRepresentation.mem.get(), existingIr, strlen(existingIr)));
 }
 
+TEST_F(CompilerInterfaceOclElfCacheTest, givenMemoryTierWhenPackAndCacheBinaryThenBinaryIsLoadedFromMemoryTierWithoutAccessingCache) {
+    mockCompilerCache->memoryTier = std::make_unique<CompilerCacheMemoryTier>(MemoryConstants::megaByte);
+
+    TranslationOutput outputFromCompilation;
+    outputFromCompilation.deviceBinary.mem = makeCopy<char>(reinterpret_cast<const char *>(patchtokensProgram.storage.data()), patchtokensProgram.storage.size());
+    outputFromCompilation.deviceBinary.size = patchtokensProgram.storage.size();
+
+    MockDevice device;
+    CompilerCacheHelper::packAndCacheBinary(*mockCompilerCache, "some_hash", NEO::getTargetDevice(device.getRootDeviceEnvironment()), outputFromCompilation);
+    EXPECT_EQ(1u, mockCompilerCache->cacheInvoked);
+    EXPECT_EQ(1u, mockCompilerCache->memoryTier->getStats().numEntries);
+
+    mockCompilerCache->hashToBinaryMap.clear();
+
+    TranslationOutput outputFromCache;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", outputFromCache, device));
+    ASSERT_EQ(outputFromCompilation.deviceBinary.size, outputFromCache.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(outputFromCompilation.deviceBinary.mem.get(), outputFromCache.deviceBinary.mem.get(), outputFromCache.deviceBinary.size));
+
+    auto stats = mockCompilerCache->memoryTier->getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(0u, stats.misses);
+}
+
+TEST_F(CompilerInterfaceOclElfCacheTest, givenMemoryTierWhenBinaryIsLoadedFromCacheThenItIsKeptInMemoryTier) {
+    mockCompilerCache->memoryTier = std::make_unique<CompilerCacheMemoryTier>(MemoryConstants::megaByte);
+
+    const std::string binary = "zebin";
+    mockCompilerCache->hashToBinaryMap["some_hash"] = binary;
+
+    MockDevice device;
+    TranslationOutput output;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", output, device));
+    EXPECT_EQ(binary.size(), output.deviceBinary.size);
+
+    mockCompilerCache->hashToBinaryMap.clear();
+
+    TranslationOutput secondOutput;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", secondOutput, device));
+    ASSERT_EQ(binary.size(), secondOutput.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(binary.c_str(), secondOutput.deviceBinary.mem.get(), binary.size()));
+    EXPECT_NE(output.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get());
+
+    TranslationOutput missingOutput;
+    EXPECT_FALSE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "other_hash", missingOutput, device));
+
+    auto stats = mockCompilerCache->memoryTier->getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(2u, stats.misses);
+    EXPECT_EQ(1u, stats.numEntries);
+}
+
+TEST_F(CompilerInterfaceOclElfCacheTest, givenAsyncWriterWhenPackAndCacheBinaryThenBinaryIsWrittenByWriterAndCanBeLoaded) {
+    mockCompilerCache->asyncWriter = std::make_unique<CompilerCacheAsyncWriter>(*mockCompilerCache, MemoryConstants::megaByte);
+
+    TranslationOutput outputFromCompilation;
+    outputFromCompilation.deviceBinary.mem = makeCopy<char>(reinterpret_cast<const char *>(patchtokensProgram.storage.data()), patchtokensProgram.storage.size());
+    outputFromCompilation.deviceBinary.size = patchtokensProgram.storage.size();
+
+    MockDevice device;
+    CompilerCacheHelper::packAndCacheBinary(*mockCompilerCache, "some_hash", NEO::getTargetDevice(device.getRootDeviceEnvironment()), outputFromCompilation);
+    mockCompilerCache->asyncWriter->flush();
+    EXPECT_EQ(1u, mockCompilerCache->cacheInvoked);
+    EXPECT_EQ(1u, mockCompilerCache->hashToBinaryMap.count("some_hash"));
+
+    TranslationOutput outputFromCache;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", outputFromCache, device));
+    ASSERT_EQ(outputFromCompilation.deviceBinary.size, outputFromCache.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(outputFromCompilation.deviceBinary.mem.get(), outputFromCache.deviceBinary.mem.get(), outputFromCache.deviceBinary.size));
+
+    mockCompilerCache->asyncWriter.reset();
+}
+
 TEST_F(CompilerInterfaceOclElfCacheTest, GivenKernelWithIncludesWhenBuildingThenPackBinaryOnCacheSaveAndUnpackBinaryOnLoadFromCache) {
     gEnvironment->igcPushDebugVars(igcDebugVarsDeviceBinary);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -157,6 +157,20 @@ TEST_F(CompilerInterfaceTest, WhenCompilingToIsaThenSuccessIsReturned) {
     EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
 }
 
+TEST_F(CompilerInterfaceTest, WhenGettingHwInfoDigestThenItIsComputedOnlyOnce) {
+    auto &hwInfo = *pDevice->getRootDeviceEnvironment().getMutableHardwareInfo();
+    const auto expectedDigest = CompilerCache::getHwInfoDigest(hwInfo);
+
+    auto &digest = pCompilerInterface->getHwInfoDigest(*pDevice);
+    EXPECT_EQ(expectedDigest, digest);
+
+    auto usRevId = hwInfo.platform.usRevId;
+    hwInfo.platform.usRevId++;
+    EXPECT_EQ(&digest, &pCompilerInterface->getHwInfoDigest(*pDevice));
+    EXPECT_EQ(expectedDigest, pCompilerInterface->getHwInfoDigest(*pDevice));
+    hwInfo.platform.usRevId = usRevId;
+}
+
 TEST_F(CompilerInterfaceTest, WhenPreferredIntermediateRepresentationSpecifiedThenPreserveIt) {
     CompilerCacheConfig config = {};
     config.enabled = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -714,6 +715,243 @@ TEST_F(LinkerTests, GivenRelocationToInstructionSegmentWithLocalUndefinedSymbolW
     EXPECT_EQ(0u, unresolvedExternals.size());
 }
 
+TEST_F(LinkerTests, GivenTaskPoolWhenPatchingInstructionsSegmentsThenSegmentsArePatchedAndUnresolvedExternalsAreReportedInSegmentsOrder) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    constexpr uint32_t numSegments = 16u;
+    for (uint32_t segId = 0u; segId < numSegments; segId++) {
+        NEO::LinkerInput::RelocationInfo resolvedRela;
+        resolvedRela.offset = 0U;
+        resolvedRela.addend = segId;
+        resolvedRela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+        resolvedRela.symbolName = "resolved";
+        resolvedRela.relocationSegment = NEO::SegmentType::instructions;
+
+        NEO::LinkerInput::RelocationInfo unresolvedRela = resolvedRela;
+        unresolvedRela.offset = sizeof(uint64_t);
+        unresolvedRela.symbolName = "unresolved_" + std::to_string(segId);
+        linkerInput.textRelocations.push_back({resolvedRela, unresolvedRela});
+    }
+
+    NEO::ParallelTaskPool taskPool(3u);
+    WhiteBox<NEO::Linker> linker(linkerInput, &taskPool);
+    linker.relocatedSymbols["resolved"].gpuAddress = 0x1000u;
+
+    std::vector<std::array<uint64_t, 2>> instructionSegmentsData(numSegments, {std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max()});
+    NEO::Linker::PatchableSegments instructionSegmentsToPatch;
+    for (auto &instructionSegmentData : instructionSegmentsData) {
+        NEO::Linker::PatchableSegment instructionSegmentToPatch;
+        instructionSegmentToPatch.hostPointer = instructionSegmentData.data();
+        instructionSegmentToPatch.segmentSize = sizeof(instructionSegmentData);
+        instructionSegmentsToPatch.push_back(instructionSegmentToPatch);
+    }
+
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    linker.patchInstructionsSegments(instructionSegmentsToPatch, unresolvedExternals, kernelDescriptors);
+
+    ASSERT_EQ(numSegments, unresolvedExternals.size());
+    for (uint32_t segId = 0u; segId < numSegments; segId++) {
+        EXPECT_EQ(0x1000u + segId, instructionSegmentsData[segId][0]);
+        EXPECT_EQ(std::numeric_limits<uint64_t>::max(), instructionSegmentsData[segId][1]);
+        EXPECT_EQ(segId, unresolvedExternals[segId].instructionsSegmentId);
+        EXPECT_EQ("unresolved_" + std::to_string(segId), unresolvedExternals[segId].unresolvedRelocation.symbolName);
+    }
+}
+
+TEST(LinkerInputTests, GivenRelocationsWhenTheyAreAddedThenSymbolIdsAreAssignedPerSymbolName) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    EXPECT_TRUE(linkerInput.getRelocationSymbolNames().empty());
+
+    vISA::GenRelocEntry entries[2] = {};
+    entries[0].r_symbol[0] = 'A';
+    entries[0].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    entries[1].r_symbol[0] = 'B';
+    entries[1].r_offset = 8;
+    entries[1].r_type = vISA::GenRelocType::R_SYM_ADDR_32;
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(entries, 2, 0));
+
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.symbolName = "B";
+    linkerInput.addElfTextSegmentRelocation(rela, 1u);
+    rela.symbolName = "C";
+    rela.relocationSegment = NEO::SegmentType::globalConstants;
+    linkerInput.addDataRelocationInfo(rela);
+
+    const auto &symbolNames = linkerInput.getRelocationSymbolNames();
+    ASSERT_EQ(3u, symbolNames.size());
+    EXPECT_EQ("A", symbolNames[0]);
+    EXPECT_EQ("B", symbolNames[1]);
+    EXPECT_EQ("C", symbolNames[2]);
+
+    ASSERT_EQ(2u, linkerInput.textRelocations.size());
+    ASSERT_EQ(2u, linkerInput.textRelocations[0].size());
+    ASSERT_EQ(1u, linkerInput.textRelocations[1].size());
+    EXPECT_EQ(0u, linkerInput.textRelocations[0][0].symbolId);
+    EXPECT_EQ(1u, linkerInput.textRelocations[0][1].symbolId);
+    EXPECT_EQ(1u, linkerInput.textRelocations[1][0].symbolId);
+    ASSERT_EQ(1u, linkerInput.dataRelocations.size());
+    EXPECT_EQ(2u, linkerInput.dataRelocations[0].symbolId);
+}
+
+TEST(LinkerInputTests, GivenSymbolsAndRelocationsWhenGettingRelocationPlanThenRelocationSymbolsAreIndexedBySymbolIdAndFollowedByRemainingSymbols) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.addSymbol("notRelocated", NEO::SymbolInfo{});
+    linkerInput.addSymbol("defined", NEO::SymbolInfo{});
+
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.symbolName = "external";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+    rela.symbolName = "defined";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+
+    const auto &relocationPlan = linkerInput.getRelocationPlan();
+    EXPECT_EQ(&relocationPlan, &linkerInput.getRelocationPlan());
+    EXPECT_EQ(2u, relocationPlan.numRelocationSymbols);
+    ASSERT_EQ(3u, relocationPlan.symbols.size());
+    EXPECT_EQ(nullptr, relocationPlan.symbols[0]);
+    ASSERT_NE(nullptr, relocationPlan.symbols[1]);
+    EXPECT_EQ("defined", relocationPlan.symbols[1]->first);
+    ASSERT_NE(nullptr, relocationPlan.symbols[2]);
+    EXPECT_EQ("notRelocated", relocationPlan.symbols[2]->first);
+}
+
+TEST_F(LinkerTests, GivenLinkerInputLinkedMultipleTimesWhenPatchingInstructionsSegmentsThenRelocationPlanIsReplayedAndUnresolvedExternalsCarrySymbolIds) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::SymbolInfo symbolInfo;
+    symbolInfo.offset = 8U;
+    symbolInfo.size = 8U;
+    symbolInfo.segment = NEO::SegmentType::globalVariables;
+    linkerInput.addSymbol("resolved", symbolInfo);
+
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.addend = 4U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.symbolName = "resolved";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+    rela.offset = sizeof(uint64_t);
+    rela.symbolName = "unresolved";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+
+    const auto *relocationPlan = &linkerInput.getRelocationPlan();
+    for (uint64_t globalVariablesAddress : {0x1000u, 0x2000u}) {
+        NEO::Linker::SegmentInfo globalVariablesSegInfo;
+        globalVariablesSegInfo.gpuAddress = globalVariablesAddress;
+        globalVariablesSegInfo.segmentSize = 16U;
+
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        ASSERT_TRUE(linker.relocateSymbols(globalVariablesSegInfo, {}, {}, {}, {}, 0U, 0U));
+        EXPECT_EQ(relocationPlan, &linkerInput.getRelocationPlan());
+        ASSERT_EQ(2u, linker.relocatedSymbolsById.size());
+        EXPECT_EQ(&linker.relocatedSymbols["resolved"], linker.relocatedSymbolsById[0]);
+        EXPECT_EQ(nullptr, linker.relocatedSymbolsById[1]);
+
+        std::array<uint64_t, 2> instructionSegmentData = {};
+        NEO::Linker::PatchableSegment instructionSegmentToPatch;
+        instructionSegmentToPatch.hostPointer = instructionSegmentData.data();
+        instructionSegmentToPatch.segmentSize = sizeof(instructionSegmentData);
+
+        NEO::Linker::UnresolvedExternals unresolvedExternals;
+        NEO::Linker::KernelDescriptorsT kernelDescriptors;
+        linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors);
+
+        EXPECT_EQ(globalVariablesAddress + symbolInfo.offset + rela.addend, instructionSegmentData[0]);
+        ASSERT_EQ(1u, unresolvedExternals.size());
+        EXPECT_EQ("unresolved", unresolvedExternals[0].unresolvedRelocation.symbolName);
+        EXPECT_EQ(1u, unresolvedExternals[0].unresolvedRelocation.symbolId);
+    }
+}
+
+TEST_F(LinkerTests, GivenRelocationPlanWhenSymbolsAndRelocationsAreAddedToLinkerInputThenNextLinkUsesRebuiltPlan) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::SymbolInfo symbolInfo;
+    symbolInfo.offset = 0U;
+    symbolInfo.size = 8U;
+    symbolInfo.segment = NEO::SegmentType::globalVariables;
+    linkerInput.addSymbol("first", symbolInfo);
+
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.symbolName = "first";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+    rela.offset = sizeof(uint64_t);
+    rela.symbolName = "second";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+
+    NEO::Linker::SegmentInfo globalVariablesSegInfo;
+    globalVariablesSegInfo.gpuAddress = 0x1000u;
+    globalVariablesSegInfo.segmentSize = 16U;
+    {
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        ASSERT_TRUE(linker.relocateSymbols(globalVariablesSegInfo, {}, {}, {}, {}, 0U, 0U));
+        ASSERT_EQ(2u, linker.relocatedSymbolsById.size());
+        EXPECT_NE(nullptr, linker.relocatedSymbolsById[0]);
+        EXPECT_EQ(nullptr, linker.relocatedSymbolsById[1]);
+    }
+
+    symbolInfo.offset = 8U;
+    linkerInput.addSymbol("second", symbolInfo);
+    EXPECT_EQ(2u, linkerInput.getRelocationPlan().symbols.size());
+    ASSERT_NE(nullptr, linkerInput.getRelocationPlan().symbols[1]);
+    EXPECT_EQ("second", linkerInput.getRelocationPlan().symbols[1]->first);
+
+    rela.offset = 2 * sizeof(uint64_t);
+    rela.symbolName = "third";
+    linkerInput.addElfTextSegmentRelocation(rela, 0u);
+    EXPECT_EQ(3u, linkerInput.getRelocationPlan().numRelocationSymbols);
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    ASSERT_TRUE(linker.relocateSymbols(globalVariablesSegInfo, {}, {}, {}, {}, 0U, 0U));
+    ASSERT_EQ(3u, linker.relocatedSymbolsById.size());
+    EXPECT_EQ(&linker.relocatedSymbols["second"], linker.relocatedSymbolsById[1]);
+    EXPECT_EQ(nullptr, linker.relocatedSymbolsById[2]);
+
+    std::array<uint64_t, 3> instructionSegmentData = {};
+    NEO::Linker::PatchableSegment instructionSegmentToPatch;
+    instructionSegmentToPatch.hostPointer = instructionSegmentData.data();
+    instructionSegmentToPatch.segmentSize = sizeof(instructionSegmentData);
+
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors);
+
+    EXPECT_EQ(0x1000u, instructionSegmentData[0]);
+    EXPECT_EQ(0x1008u, instructionSegmentData[1]);
+    ASSERT_EQ(1u, unresolvedExternals.size());
+    EXPECT_EQ("third", unresolvedExternals[0].unresolvedRelocation.symbolName);
+}
+
+TEST_F(LinkerTests, GivenRelocationWithoutSymbolIdWhenPatchingInstructionsSegmentsThenSymbolIsFoundByName) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.symbolName = "resolved";
+    rela.relocationSegment = NEO::SegmentType::instructions;
+    linkerInput.textRelocations.push_back({rela});
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    EXPECT_EQ(NEO::LinkerInput::invalidSymbolId, linkerInput.textRelocations[0][0].symbolId);
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.relocatedSymbols["resolved"].gpuAddress = 0x1000u;
+
+    uint64_t instructionSegmentData = 0U;
+    NEO::Linker::PatchableSegment instructionSegmentToPatch;
+    instructionSegmentToPatch.hostPointer = &instructionSegmentData;
+    instructionSegmentToPatch.segmentSize = sizeof(instructionSegmentData);
+
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors);
+
+    EXPECT_EQ(0x1000u, instructionSegmentData);
+    EXPECT_TRUE(unresolvedExternals.empty());
+}
+
 TEST(LinkerInputTests, GivenInvalidFunctionsSymbolsUsedInFunctionsRelocationsWhenParsingRelocationsForExtFuncUsageThenDoNotAddDependency) {
     WhiteBox<NEO::LinkerInput> mockLinkerInput;
 
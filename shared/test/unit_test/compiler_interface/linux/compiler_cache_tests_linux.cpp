@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_indexed.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
@@ -1086,3 +1087,114 @@ TEST(CompilerCacheHelper, GivenNotExistingPathWhenGettingFileSizeThenZeroIsRetur
 
     EXPECT_EQ(getFileSize("/tmp/file1"), 0u);
 }
+
+namespace IndexedCachePass {
+int mockOpenWithMode(const char *pathname, int flags, int mode) {
+    return NEO::SysCalls::fakeFileDescriptor;
+}
+} // namespace IndexedCachePass
+
+TEST(CompilerCacheIndexedTests, GivenIndexedStoreEnabledInConfigWhenCreatingCompilerCacheThenIndexedCacheIsCreated) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+
+    CompilerCacheConfig config = {};
+    config.enabled = true;
+    config.cacheFileExtension = ".cl_cache";
+    config.cacheDir = "/home/cl_cache/";
+    config.cacheSize = 2 * CompilerCachePack::getMinimalPackSize();
+
+    auto cache = CompilerCache::create(config);
+    EXPECT_EQ(nullptr, dynamic_cast<CompilerCacheIndexed *>(cache.get()));
+
+    config.useIndexedStore = true;
+    cache = CompilerCache::create(config);
+    auto indexedCache = dynamic_cast<CompilerCacheIndexed *>(cache.get());
+    ASSERT_NE(nullptr, indexedCache);
+    EXPECT_TRUE(indexedCache->isPackAvailable());
+    EXPECT_EQ("/home/cl_cache/cl_cache.pack", indexedCache->getPackFilePath());
+}
+
+TEST(CompilerCacheIndexedTests, GivenMappedPackWhenCachingBinaryThenBinaryIsLoadedFromPack) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+    VariableBackup<int> ftruncateCalledBackup(&NEO::SysCalls::ftruncateCalled, 0);
+    VariableBackup<int> flockCalledBackup(&NEO::SysCalls::flockCalled, 0);
+    VariableBackup<int> mkstempCalledBackup(&NEO::SysCalls::mkstempCalled, 0);
+
+    CompilerCacheConfig config = {};
+    config.enabled = true;
+    config.cacheFileExtension = ".cl_cache";
+    config.cacheDir = "/home/cl_cache/";
+    config.cacheSize = 2 * CompilerCachePack::getMinimalPackSize();
+    config.useIndexedStore = true;
+
+    CompilerCacheIndexed cache(config);
+    ASSERT_TRUE(cache.isPackAvailable());
+    EXPECT_EQ(1, NEO::SysCalls::ftruncateCalled);
+
+    const char binary[] = "12345";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary, sizeof(binary)));
+    EXPECT_EQ(0, NEO::SysCalls::mkstempCalled);
+
+    size_t loadedSize = 0u;
+    auto loaded = cache.loadCachedBinary("0123456789abcdef", loadedSize);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), loadedSize);
+    EXPECT_STREQ(binary, loaded.get());
+
+    auto flockCalls = NEO::SysCalls::flockCalled;
+    loaded = cache.loadCachedBinary("fedcba9876543210", loadedSize);
+    EXPECT_EQ(nullptr, loaded);
+    EXPECT_EQ(flockCalls, NEO::SysCalls::flockCalled);
+}
+
+TEST(CompilerCacheIndexedTests, GivenCacheSizeSmallerThanMinimalPackSizeWhenCreatingIndexedCacheThenPackIsNotUsed) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+    VariableBackup<int> ftruncateCalledBackup(&NEO::SysCalls::ftruncateCalled, 0);
+
+    CompilerCacheConfig config = {};
+    config.enabled = true;
+    config.cacheFileExtension = ".cl_cache";
+    config.cacheDir = "/home/cl_cache/";
+    config.cacheSize = CompilerCachePack::getMinimalPackSize() - 1;
+    config.useIndexedStore = true;
+
+    CompilerCacheIndexed cache(config);
+    EXPECT_FALSE(cache.isPackAvailable());
+    EXPECT_EQ(0, NEO::SysCalls::ftruncateCalled);
+}
+
+TEST(CompilerCacheIndexedTests, GivenFailingPackFileOperationsWhenCreatingIndexedCacheThenPackIsNotUsed) {
+    CompilerCacheConfig config = {};
+    config.enabled = true;
+    config.cacheFileExtension = ".cl_cache";
+    config.cacheDir = "/home/cl_cache/";
+    config.cacheSize = 2 * CompilerCachePack::getMinimalPackSize();
+    config.useIndexedStore = true;
+
+    {
+        VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int { return -1; });
+        CompilerCacheIndexed cache(config);
+        EXPECT_FALSE(cache.isPackAvailable());
+    }
+    {
+        VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+        VariableBackup<int> flockBackup(&NEO::SysCalls::flockRetVal, -1);
+        CompilerCacheIndexed cache(config);
+        EXPECT_FALSE(cache.isPackAvailable());
+    }
+    {
+        VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+        VariableBackup<decltype(NEO::SysCalls::sysCallsFtruncate)> ftruncateBackup(&NEO::SysCalls::sysCallsFtruncate, [](int fd, off_t length) -> int { return -1; });
+        CompilerCacheIndexed cache(config);
+        EXPECT_FALSE(cache.isPackAvailable());
+    }
+    {
+        VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, IndexedCachePass::mockOpenWithMode);
+        VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+            buf->st_size = 4096;
+            return 0;
+        });
+        CompilerCacheIndexed cache(config);
+        EXPECT_FALSE(cache.isPackAvailable());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,68 @@ TEST(ClCacheDefaultConfigLinuxTest, GivenAllEnvVarWhenProperlySetThenProperConfi
     EXPECT_EQ(cacheConfig.cacheDir, "ult/directory/");
 }
 
+TEST(ClCacheDefaultConfigLinuxTest, GivenNeoCacheIndexedEnvVarWhenGettingConfigThenIndexedStoreIsSelected) {
+    std::unordered_map<std::string, std::string> mockableEnvs;
+    mockableEnvs["NEO_CACHE_PERSISTENT"] = "1";
+    mockableEnvs["NEO_CACHE_DIR"] = "ult/directory/";
+
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&NEO::IoFunctions::mockableEnvValues, &mockableEnvs);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, AllVariablesCorrectlySet::statMock);
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_FALSE(cacheConfig.useIndexedStore);
+
+    mockableEnvs["NEO_CACHE_INDEXED"] = "1";
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_TRUE(cacheConfig.useIndexedStore);
+}
+
+TEST(ClCacheDefaultConfigLinuxTest, GivenNeoCacheAsyncWriteEnvVarWhenGettingConfigThenAsyncWritebackIsEnabled) {
+    std::unordered_map<std::string, std::string> mockableEnvs;
+    mockableEnvs["NEO_CACHE_PERSISTENT"] = "1";
+    mockableEnvs["NEO_CACHE_DIR"] = "ult/directory/";
+
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&NEO::IoFunctions::mockableEnvValues, &mockableEnvs);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, AllVariablesCorrectlySet::statMock);
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_FALSE(cacheConfig.asyncWriteback);
+
+    mockableEnvs["NEO_CACHE_ASYNC_WRITE"] = "1";
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_TRUE(cacheConfig.asyncWriteback);
+}
+
+TEST(ClCacheDefaultConfigLinuxTest, GivenNeoCacheMemorySizeEnvVarWhenGettingConfigThenMemoryTierIsEnabledOnlyForPositiveSize) {
+    std::unordered_map<std::string, std::string> mockableEnvs;
+    mockableEnvs["NEO_CACHE_PERSISTENT"] = "1";
+    mockableEnvs["NEO_CACHE_DIR"] = "ult/directory/";
+
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&NEO::IoFunctions::mockableEnvValues, &mockableEnvs);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, AllVariablesCorrectlySet::statMock);
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(0u, cacheConfig.memoryTierSize);
+
+    mockableEnvs["NEO_CACHE_MEMORY_SIZE"] = "4096";
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_EQ(4096u, cacheConfig.memoryTierSize);
+
+    mockableEnvs["NEO_CACHE_MEMORY_SIZE"] = "0";
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_EQ(0u, cacheConfig.memoryTierSize);
+
+    mockableEnvs["NEO_CACHE_MEMORY_SIZE"] = "-1";
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(0u, cacheConfig.memoryTierSize);
+}
+
 namespace NonExistingPathIsSet {
 int statMock(const std::string &filePath, struct stat *statbuf) noexcept {
     return -1;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_enum_lookup.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -18,6 +19,7 @@
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
@@ -4354,6 +4356,241 @@ TEST(DecodeZebinTest, givenGtpinInfoSectionsWhenDecodingZebinThenProperlySetIgcI
     EXPECT_EQ(0, memcmp(reinterpret_cast<const uint8_t *>(kernelInfo2->igcInfoForGtpin), mockGtpinData2.data(), mockGtpinData2.size()));
 }
 
+TEST(DeferredZeInfoKernelsDecoding, givenZeInfoWithKernelsWhenIndexingKernelsThenNamesAndSectionsReferenceZeInfoWithoutParsingIt) {
+    ConstStringRef zeinfo = R"===(version: '1.7'
+kernels:
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+# comment between kernels
+  - execution_env:
+      simd_size: 16
+    name : "kernel_b"
+    payload_arguments:
+      - arg_type: global_id_offset
+        name: not_a_kernel_name
+        offset: 0
+        size: 12
+functions:
+  - name: fun
+    execution_env:
+      simd_size: 8
+)===";
+    NEO::Zebin::ZeInfo::ZeInfoKernelsIndex kernelsIndex;
+    ASSERT_TRUE(NEO::Zebin::ZeInfo::indexZeInfoKernels(zeinfo, kernelsIndex));
+    ASSERT_EQ(2U, kernelsIndex.kernels.size());
+
+    EXPECT_EQ(zeinfo.begin() + zeinfo.str().find("kernels:"), zeinfo.begin() + kernelsIndex.kernelsBlockBegin);
+    EXPECT_EQ(zeinfo.begin() + zeinfo.str().find("functions:"), zeinfo.begin() + kernelsIndex.kernelsBlockEnd);
+
+    EXPECT_EQ("kernel_a", kernelsIndex.kernels[0].name.str());
+    EXPECT_EQ("kernel_b", kernelsIndex.kernels[1].name.str());
+    for (const auto &kernel : kernelsIndex.kernels) {
+        EXPECT_LE(zeinfo.begin(), kernel.name.begin());
+        EXPECT_GE(zeinfo.end(), kernel.name.end());
+        EXPECT_LE(zeinfo.begin(), kernel.section.begin());
+        EXPECT_GE(zeinfo.end(), kernel.section.end());
+    }
+    EXPECT_EQ(zeinfo.begin() + zeinfo.str().find("  - name: kernel_a"), kernelsIndex.kernels[0].section.begin());
+    EXPECT_EQ(zeinfo.begin() + zeinfo.str().find("  - execution_env"), kernelsIndex.kernels[0].section.end());
+    EXPECT_EQ(kernelsIndex.kernels[0].section.end(), kernelsIndex.kernels[1].section.begin());
+    EXPECT_EQ(zeinfo.begin() + kernelsIndex.kernelsBlockEnd, kernelsIndex.kernels[1].section.end());
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenZeInfoNotInBlockStyleWhenIndexingKernelsThenFalseIsReturned) {
+    NEO::Zebin::ZeInfo::ZeInfoKernelsIndex kernelsIndex;
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("version: '1.7'\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels: [ { name: kernel } ]\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n- name: kernel\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n  - execution_env:\n      simd_size: 8\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n  - name: kernel\n\texecution_env:\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n  - name: kernel_a\nkernels:\n  - name: kernel_b\n", kernelsIndex));
+    EXPECT_FALSE(NEO::Zebin::ZeInfo::indexZeInfoKernels("kernels:\n    - name: kernel_a\n  - name: kernel_b\n", kernelsIndex));
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenDeferredDecodingEnabledWhenDecodingZeInfoThenOnlyGlobalScopeIsDecodedAndKernelDescriptorsAreDecodedOnDemand) {
+    ConstStringRef zeinfo = R"===(version: '1.7'
+kernels:
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+      slm_size: 64
+    payload_arguments:
+      - arg_type: arg_bypointer
+        offset: 0
+        size: 8
+        arg_index: 0
+        addrmode: stateful
+        addrspace: global
+        access_type: readwrite
+    binding_table_indices:
+      - bti_value: 0
+        arg_index: 0
+  - name: kernel_b
+    execution_env:
+      simd_size: 16
+global_host_access_table:
+  - device_name: int_var
+    host_name: IntVarName
+functions:
+  - name: fun
+    execution_env:
+      grf_count: 128
+      simd_size: 8
+)===";
+    NEO::ProgramInfo eagerProgramInfo;
+    std::string errors, warnings;
+    auto err = NEO::Zebin::ZeInfo::decodeZeInfo(eagerProgramInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+
+    NEO::ProgramInfo programInfo;
+    programInfo.deferKernelsZeInfoDecoding = true;
+    err = NEO::Zebin::ZeInfo::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    EXPECT_EQ(eagerProgramInfo.globalsDeviceToHostNameMap, programInfo.globalsDeviceToHostNameMap);
+    ASSERT_EQ(1U, programInfo.externalFunctions.size());
+    EXPECT_EQ("fun", programInfo.externalFunctions[0].functionName);
+    EXPECT_EQ(128U, programInfo.externalFunctions[0].numGrfRequired);
+
+    ASSERT_EQ(2U, programInfo.kernelInfos.size());
+    for (auto kernelInfo : programInfo.kernelInfos) {
+        EXPECT_TRUE(kernelInfo->isKernelDescriptorDeferred());
+        EXPECT_TRUE(kernelInfo->kernelDescriptor.payloadMappings.explicitArgs.empty());
+        EXPECT_EQ(NEO::DeviceBinaryFormat::zebin, kernelInfo->kernelDescriptor.kernelAttributes.binaryFormat);
+        EXPECT_LE(zeinfo.begin(), kernelInfo->deferredZeInfo.kernelSection.begin());
+        EXPECT_GE(zeinfo.end(), kernelInfo->deferredZeInfo.kernelSection.end());
+    }
+    EXPECT_EQ("kernel_a", programInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ("kernel_b", programInfo.kernelInfos[1]->kernelDescriptor.kernelMetadata.kernelName);
+
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernel(*programInfo.kernelInfos[1], errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::success, err) << errors;
+    EXPECT_FALSE(programInfo.kernelInfos[1]->isKernelDescriptorDeferred());
+    EXPECT_TRUE(programInfo.kernelInfos[0]->isKernelDescriptorDeferred());
+    EXPECT_EQ(16U, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.simdSize);
+
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(programInfo.kernelInfos, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::success, err) << errors;
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    for (size_t i = 0; i < programInfo.kernelInfos.size(); ++i) {
+        auto &kernelInfo = *programInfo.kernelInfos[i];
+        auto &eagerKernelInfo = *eagerProgramInfo.kernelInfos[i];
+        EXPECT_FALSE(kernelInfo.isKernelDescriptorDeferred());
+        EXPECT_EQ(eagerKernelInfo.kernelDescriptor.kernelMetadata.kernelName, kernelInfo.kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(eagerKernelInfo.kernelDescriptor.kernelAttributes.simdSize, kernelInfo.kernelDescriptor.kernelAttributes.simdSize);
+        EXPECT_EQ(eagerKernelInfo.kernelDescriptor.kernelAttributes.slmInlineSize, kernelInfo.kernelDescriptor.kernelAttributes.slmInlineSize);
+        EXPECT_EQ(eagerKernelInfo.kernelDescriptor.payloadMappings.explicitArgs.size(), kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.size());
+        EXPECT_EQ(eagerKernelInfo.kernelDescriptor.generatedSsh.size(), kernelInfo.heapInfo.surfaceStateHeapSize);
+        EXPECT_EQ(kernelInfo.kernelDescriptor.generatedSsh.data(), kernelInfo.heapInfo.pSsh);
+        EXPECT_EQ(kernelInfo.kernelDescriptor.generatedDsh.data(), kernelInfo.heapInfo.pDsh);
+    }
+    EXPECT_NE(0U, programInfo.kernelInfos[0]->heapInfo.surfaceStateHeapSize);
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenDeferredDecodingEnabledAndInvalidKernelSectionWhenDecodingKernelDescriptorThenErrorIsReturned) {
+    ConstStringRef zeinfo = R"===(kernels:
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+  - name: kernel_b
+    execution_env:
+      simd_size: 8
+      unknown_attribute: 1
+  - name: kernel_c
+)===";
+
+    NEO::ProgramInfo programInfo;
+    programInfo.deferKernelsZeInfoDecoding = true;
+    std::string errors, warnings;
+    auto err = NEO::Zebin::ZeInfo::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+    ASSERT_EQ(3U, programInfo.kernelInfos.size());
+
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernel(*programInfo.kernelInfos[0], errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::success, err);
+
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(programInfo.kernelInfos, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::unkownZeinfoAttribute, err);
+    EXPECT_TRUE(programInfo.kernelInfos[1]->isKernelDescriptorDeferred());
+
+    errors.clear();
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernel(*programInfo.kernelInfos[2], errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::invalidBinary, err);
+    EXPECT_FALSE(errors.empty());
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenDeferredDecodingEnabledAndZeInfoWhichCannotBeIndexedWhenDecodingZeInfoThenAllKernelsAreDecoded) {
+    ConstStringRef zeinfo = R"===(kernels: # all kernels
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+)===";
+
+    NEO::ProgramInfo programInfo;
+    programInfo.deferKernelsZeInfoDecoding = true;
+    std::string errors, warnings;
+    auto err = NEO::Zebin::ZeInfo::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+    EXPECT_FALSE(programInfo.kernelInfos[0]->isKernelDescriptorDeferred());
+    EXPECT_EQ(8U, programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenDeferredDecodingNotRequestedByCallerWhenDecodingZeInfoThenAllKernelsAreDecoded) {
+    ConstStringRef zeinfo = R"===(kernels:
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+  - name: kernel_b
+    execution_env:
+      simd_size: 16
+)===";
+
+    NEO::ProgramInfo programInfo;
+    std::string errors, warnings;
+    auto err = NEO::Zebin::ZeInfo::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+    ASSERT_EQ(2U, programInfo.kernelInfos.size());
+    EXPECT_FALSE(programInfo.kernelInfos[0]->isKernelDescriptorDeferred());
+    EXPECT_EQ(8U, programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_FALSE(programInfo.kernelInfos[1]->isKernelDescriptorDeferred());
+    EXPECT_EQ(16U, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST(DeferredZeInfoKernelsDecoding, givenDeferredDecodingEnabledWhenDecodingZebinThenKernelHeapIsSetAndGeneratedHeapsAreSetWhenKernelDescriptorIsDecoded) {
+
+    std::string errors, warnings;
+    ZebinTestData::ValidEmptyProgram zebin;
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::ProgramInfo programInfo;
+    programInfo.deferKernelsZeInfoDecoding = true;
+    auto err = decodeZebin(programInfo, elf, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::success, err) << errors;
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+
+    auto kernelInfo = programInfo.kernelInfos[0];
+    EXPECT_TRUE(kernelInfo->isKernelDescriptorDeferred());
+    EXPECT_STREQ(zebin.kernelName, kernelInfo->kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_NE(nullptr, kernelInfo->heapInfo.pKernelHeap);
+    EXPECT_NE(0U, kernelInfo->heapInfo.kernelHeapSize);
+
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(programInfo.kernelInfos, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::success, err) << errors;
+    EXPECT_FALSE(kernelInfo->isKernelDescriptorDeferred());
+    EXPECT_EQ(32U, kernelInfo->kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_EQ(128U, kernelInfo->kernelDescriptor.kernelAttributes.numGrfRequired);
+    EXPECT_EQ(kernelInfo->kernelDescriptor.generatedSsh.data(), kernelInfo->heapInfo.pSsh);
+    EXPECT_EQ(kernelInfo->kernelDescriptor.generatedSsh.size(), kernelInfo->heapInfo.surfaceStateHeapSize);
+    EXPECT_EQ(kernelInfo->kernelDescriptor.generatedDsh.data(), kernelInfo->heapInfo.pDsh);
+    EXPECT_EQ(kernelInfo->kernelDescriptor.generatedDsh.size(), kernelInfo->heapInfo.dynamicStateHeapSize);
+}
+
 TEST_F(decodeZeInfoKernelEntryTest, GivenValidExecutionEnvironmentThenPopulateKernelDescriptorProperly) {
     ConstStringRef zeinfo = R"===(
 kernels:
@@ -7085,3 +7322,44 @@ TEST(EncounterUnknownZeInfoAttribute, givenEnvVariabletoIgnoreUnknownAttributesW
     EXPECT_TRUE(errorMessage.empty()) << errorMessage;
     EXPECT_FALSE(warning.empty());
 }
+
+TEST(DeferredZeInfoKernelsDecoding, givenTaskPoolWhenDecodingKernelDescriptorsThenResultsAndErrorsAreSameAsInSequentialDecoding) {
+    ConstStringRef zeinfo = R"===(kernels:
+  - name: kernel_a
+    execution_env:
+      simd_size: 8
+  - name: kernel_b
+    execution_env:
+      simd_size: 16
+      unknown_attribute: 1
+  - name: kernel_c
+    execution_env:
+      simd_size: 32
+)===";
+
+    NEO::ProgramInfo sequentialProgramInfo;
+    sequentialProgramInfo.deferKernelsZeInfoDecoding = true;
+    std::string sequentialErrors, sequentialWarnings;
+    auto err = NEO::Zebin::ZeInfo::decodeZeInfo(sequentialProgramInfo, zeinfo, sequentialErrors, sequentialWarnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << sequentialErrors;
+    auto sequentialErr = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(sequentialProgramInfo.kernelInfos, sequentialErrors, sequentialWarnings);
+    EXPECT_EQ(NEO::DecodeError::unkownZeinfoAttribute, sequentialErr);
+
+    NEO::ParallelTaskPool taskPool(2u);
+    NEO::ProgramInfo programInfo;
+    programInfo.deferKernelsZeInfoDecoding = true;
+    std::string errors, warnings;
+    err = NEO::Zebin::ZeInfo::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, err) << errors;
+    err = NEO::Zebin::ZeInfo::decodeDeferredZeInfoKernels(programInfo.kernelInfos, errors, warnings, &taskPool);
+    EXPECT_EQ(sequentialErr, err);
+    EXPECT_EQ(sequentialErrors, errors);
+    EXPECT_EQ(sequentialWarnings, warnings);
+
+    ASSERT_EQ(3U, programInfo.kernelInfos.size());
+    EXPECT_FALSE(programInfo.kernelInfos[0]->isKernelDescriptorDeferred());
+    EXPECT_EQ(8U, programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_TRUE(programInfo.kernelInfos[1]->isKernelDescriptorDeferred());
+    EXPECT_FALSE(programInfo.kernelInfos[2]->isKernelDescriptorDeferred());
+    EXPECT_EQ(32U, programInfo.kernelInfos[2]->kernelDescriptor.kernelAttributes.simdSize);
+}
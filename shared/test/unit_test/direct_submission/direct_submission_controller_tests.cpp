@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,101 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdlePolicyWhenSubmissionsArriveWithRegularGapsThenRingIsStoppedOnlyAfterLearnedIdleTimeout) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerTimeout.set(1'000);
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleMaxTimeout.set(20'000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_EQ(20'000, controller.adaptiveIdleMaxTimeout.count());
+    controller.timeoutElapsedReturnValue.store(TimeoutElapsedMode::fullyElapsed);
+    controller.registerDirectSubmission(&csr);
+
+    for (uint32_t submission = 1u; submission <= 8u; submission++) {
+        controller.cpuTimestamp += std::chrono::microseconds{3'000};
+        csr.taskCount.store(submission);
+        controller.checkNewSubmissions();
+        EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    }
+
+    DirectSubmissionIdleStats idleStats;
+    EXPECT_TRUE(controller.getIdleStats(&csr, idleStats));
+    EXPECT_LT(3'000, idleStats.idleTimeout.count());
+    EXPECT_GT(20'000, idleStats.idleTimeout.count());
+    EXPECT_LT(0, idleStats.averageSubmissionGap.count());
+    EXPECT_EQ(0u, idleStats.stopCount);
+    EXPECT_EQ(0u, idleStats.restartCount);
+
+    controller.cpuTimestamp += std::chrono::microseconds{3'000};
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    controller.cpuTimestamp += idleStats.idleTimeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    csr.taskCount.store(9u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    EXPECT_TRUE(controller.getIdleStats(&csr, idleStats));
+    EXPECT_EQ(1u, idleStats.stopCount);
+    EXPECT_EQ(1u, idleStats.restartCount);
+
+    controller.unregisterDirectSubmission(&csr);
+    EXPECT_FALSE(controller.getIdleStats(&csr, idleStats));
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdlePolicyWhenSubmissionGapsExceedMaxTimeoutThenIdleTimeoutIsBaseTimeout) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerTimeout.set(1'000);
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleMaxTimeout.set(20'000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.timeoutElapsedReturnValue.store(TimeoutElapsedMode::fullyElapsed);
+    controller.registerDirectSubmission(&csr);
+
+    for (uint32_t submission = 1u; submission <= 2u; submission++) {
+        controller.cpuTimestamp += std::chrono::microseconds{30'000};
+        csr.taskCount.store(submission);
+        controller.checkNewSubmissions();
+    }
+
+    DirectSubmissionIdleStats idleStats;
+    EXPECT_TRUE(controller.getIdleStats(&csr, idleStats));
+    EXPECT_EQ(controller.timeout, idleStats.idleTimeout);
+
+    controller.cpuTimestamp += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 TEST(DirectSubmissionControllerTests, givenDebugFlagSetWhenCheckingIfTimeoutElapsedThenReturnCorrectValue) {
     DebugManagerStateRestore restorer;
     DirectSubmissionControllerMock defaultController;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/direct_submission/direct_submission_trace.h"
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -20,6 +21,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/source/memory_manager/memory_allocation.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -2818,6 +2820,84 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenNotStartedDirectSubmissionWhen
     EXPECT_FALSE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionTraceEnabledWhenDispatchingCommandBuffersThenEachDispatchIsRecorded) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTraceEntries.set(3);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    ASSERT_NE(nullptr, directSubmission.trace);
+    EXPECT_EQ(4u, directSubmission.trace->getCapacity());
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+
+    directSubmission.updateTagValueReturn = 0x123u;
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+
+    auto entries = directSubmission.trace->snapshot();
+    ASSERT_EQ(2u, entries.size());
+    EXPECT_NE(0u, entries[0].flags & DirectSubmissionTraceFlags::ringStart);
+    EXPECT_EQ(0u, entries[1].flags & DirectSubmissionTraceFlags::ringStart);
+    for (auto &entry : entries) {
+        EXPECT_EQ(0x123u, entry.tagValue);
+        EXPECT_NE(0u, entry.dispatchSize);
+        EXPECT_LE(entry.dispatchStartNs, entry.submitEndNs);
+    }
+    EXPECT_EQ(entries[0].queueWorkCount + 1, entries[1].queueWorkCount);
+    EXPECT_LT(entries[0].dispatchGpuVa, entries[1].dispatchGpuVa);
+
+    directSubmission.trace.reset();
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionTraceEnabledWhenGpuHangIsDetectedDuringDispatchThenTraceIsDumped) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTraceEntries.set(8);
+
+    const auto traceFileSize = sizeof(DirectSubmissionTraceFileHeader) + sizeof(DirectSubmissionTraceEntry);
+    auto fileBuffer = std::make_unique<char[]>(traceFileSize);
+    VariableBackup<size_t> mockFwriteReturnBackup(&IoFunctions::mockFwriteReturn, traceFileSize);
+    VariableBackup<char *> mockFwriteBufferBackup(&IoFunctions::mockFwriteBuffer, fileBuffer.get());
+    auto mockFopenCalledBefore = IoFunctions::mockFopenCalled;
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    directSubmission.updateTagValueReturn = std::numeric_limits<uint64_t>::max();
+
+    EXPECT_FALSE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(mockFopenCalledBefore + 1, IoFunctions::mockFopenCalled);
+
+    DirectSubmissionTraceFileHeader header = {};
+    memcpy_s(&header, sizeof(header), fileBuffer.get(), sizeof(header));
+    EXPECT_EQ(DirectSubmissionTrace::fileMagic, header.magic);
+    EXPECT_EQ(1u, header.entryCount);
+
+    DirectSubmissionTraceEntry entry = {};
+    memcpy_s(&entry, sizeof(entry), fileBuffer.get() + sizeof(header), sizeof(entry));
+    EXPECT_NE(0u, entry.flags & DirectSubmissionTraceFlags::gpuHang);
+
+    EXPECT_TRUE(directSubmission.dumpTrace());
+    EXPECT_EQ(mockFopenCalledBefore + 2, IoFunctions::mockFopenCalled);
+
+    directSubmission.trace.reset();
+    EXPECT_FALSE(directSubmission.dumpTrace());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionTraceWhenGettingTraceFileNameThenProcessIdIsIncludedAndGpuHangDumpUsesSeparateFile) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    auto contextId = std::to_string(pDevice->getDefaultEngine().osContext->getContextId());
+    auto expectedPrefix = "ulls_trace_" + std::to_string(SysCalls::getProcessId()) + "_" + std::to_string(pDevice->getRootDeviceIndex()) + "_" + contextId;
+    EXPECT_EQ(expectedPrefix + ".bin", directSubmission.getTraceFileName(false));
+    EXPECT_EQ(expectedPrefix + "_gpu_hang.bin", directSubmission.getTraceFileName(true));
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest, givenDispatchBufferNotRequiresBlockingResidencyHandlingThenDontWaitForResidencyAndProgramSemaphore) {
     using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
     using Dispatcher = RenderDispatcher<FamilyType>;
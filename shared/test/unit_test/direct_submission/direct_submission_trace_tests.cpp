@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_trace.h"
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_io_functions.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+namespace {
+DirectSubmissionTraceEntry createTraceEntry(uint32_t queueWorkCount) {
+    DirectSubmissionTraceEntry entry = {};
+    entry.dispatchStartNs = 100u * queueWorkCount;
+    entry.submitEndNs = 100u * queueWorkCount + 10u;
+    entry.queueWorkCount = queueWorkCount;
+    return entry;
+}
+} // namespace
+
+TEST(DirectSubmissionTraceTest, givenRequestedCapacityWhenCreatingTraceThenCapacityIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(1u, DirectSubmissionTrace(0u).getCapacity());
+    EXPECT_EQ(8u, DirectSubmissionTrace(5u).getCapacity());
+    EXPECT_EQ(16u, DirectSubmissionTrace(16u).getCapacity());
+}
+
+TEST(DirectSubmissionTraceTest, givenMoreEntriesThanCapacityRecordedWhenTakingSnapshotThenLatestEntriesAreReturnedInOrder) {
+    DirectSubmissionTrace trace(4u);
+    EXPECT_TRUE(trace.snapshot().empty());
+
+    for (uint32_t queueWorkCount = 1u; queueWorkCount <= 6u; queueWorkCount++) {
+        trace.record(createTraceEntry(queueWorkCount));
+    }
+    EXPECT_EQ(6u, trace.getRecordedCount());
+
+    auto entries = trace.snapshot();
+    ASSERT_EQ(4u, entries.size());
+    for (uint32_t i = 0u; i < entries.size(); i++) {
+        EXPECT_EQ(i + 3u, entries[i].queueWorkCount);
+    }
+}
+
+TEST(DirectSubmissionTraceTest, givenRecordedEntriesWhenDumpingThenHeaderAndEntriesAreWrittenToFile) {
+    DirectSubmissionTrace trace(2u);
+    for (uint32_t queueWorkCount = 1u; queueWorkCount <= 3u; queueWorkCount++) {
+        trace.record(createTraceEntry(queueWorkCount));
+    }
+
+    const auto fileSize = sizeof(DirectSubmissionTraceFileHeader) + 2 * sizeof(DirectSubmissionTraceEntry);
+    auto fileBuffer = std::make_unique<char[]>(fileSize);
+    VariableBackup<size_t> mockFwriteReturnBackup(&IoFunctions::mockFwriteReturn, fileSize);
+    VariableBackup<char *> mockFwriteBufferBackup(&IoFunctions::mockFwriteBuffer, fileBuffer.get());
+    auto mockFcloseCalledBefore = IoFunctions::mockFcloseCalled;
+
+    EXPECT_TRUE(trace.dump("trace.bin"));
+    EXPECT_EQ(mockFcloseCalledBefore + 1, IoFunctions::mockFcloseCalled);
+
+    DirectSubmissionTraceFileHeader header = {};
+    memcpy_s(&header, sizeof(header), fileBuffer.get(), sizeof(header));
+    EXPECT_EQ(DirectSubmissionTrace::fileMagic, header.magic);
+    EXPECT_EQ(DirectSubmissionTrace::fileVersion, header.version);
+    EXPECT_EQ(sizeof(DirectSubmissionTraceEntry), header.entrySize);
+    EXPECT_EQ(2u, header.entryCount);
+    EXPECT_EQ(1u, header.droppedEntries);
+
+    DirectSubmissionTraceEntry entries[2] = {};
+    memcpy_s(entries, sizeof(entries), fileBuffer.get() + sizeof(header), sizeof(entries));
+    EXPECT_EQ(2u, entries[0].queueWorkCount);
+    EXPECT_EQ(3u, entries[1].queueWorkCount);
+}
+
+TEST(DirectSubmissionTraceTest, givenFileCannotBeOpenedWhenDumpingThenFalseIsReturned) {
+    DirectSubmissionTrace trace(2u);
+    trace.record(createTraceEntry(1u));
+
+    VariableBackup<FILE *> mockFopenReturnedBackup(&IoFunctions::mockFopenReturned, static_cast<FILE *>(nullptr));
+    auto mockFwriteCalledBefore = IoFunctions::mockFwriteCalled;
+
+    EXPECT_FALSE(trace.dump("trace.bin"));
+    EXPECT_EQ(mockFwriteCalledBefore, IoFunctions::mockFwriteCalled);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/parallel_task_pool.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_ail_configuration.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -252,6 +253,42 @@ TEST(ExecutionEnvironment, givenEnableDirectSubmissionControllerSetZeroWhenIniti
     EXPECT_EQ(controller, nullptr);
 }
 
+TEST(ExecutionEnvironment, givenModuleInitWorkerThreadsNotSetWhenInitializeTaskPoolThenNull) {
+    MockExecutionEnvironment executionEnvironment{};
+    EXPECT_EQ(nullptr, executionEnvironment.initializeTaskPool());
+}
+
+TEST(ExecutionEnvironment, givenModuleInitWorkerThreadsSetWhenInitializeTaskPoolThenPoolWithRequestedWorkersIsCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ModuleInitWorkerThreads.set(2);
+
+    MockExecutionEnvironment executionEnvironment{};
+    auto taskPool = executionEnvironment.initializeTaskPool();
+
+    ASSERT_NE(nullptr, taskPool);
+    EXPECT_EQ(2u, taskPool->getNumWorkers());
+    EXPECT_EQ(taskPool, executionEnvironment.initializeTaskPool());
+}
+
+TEST(ExecutionEnvironment, givenCpuCopyWorkerThreadsNotSetWhenInitializeCpuCopyTaskPoolThenNull) {
+    MockExecutionEnvironment executionEnvironment{};
+    EXPECT_EQ(nullptr, executionEnvironment.initializeCpuCopyTaskPool());
+}
+
+TEST(ExecutionEnvironment, givenCpuCopyWorkerThreadsSetWhenInitializeCpuCopyTaskPoolThenPoolSeparateFromModuleInitPoolIsCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyWorkerThreads.set(2);
+    debugManager.flags.ModuleInitWorkerThreads.set(1);
+
+    MockExecutionEnvironment executionEnvironment{};
+    auto cpuCopyTaskPool = executionEnvironment.initializeCpuCopyTaskPool();
+
+    ASSERT_NE(nullptr, cpuCopyTaskPool);
+    EXPECT_EQ(2u, cpuCopyTaskPool->getNumWorkers());
+    EXPECT_EQ(cpuCopyTaskPool, executionEnvironment.initializeCpuCopyTaskPool());
+    EXPECT_NE(cpuCopyTaskPool, executionEnvironment.initializeTaskPool());
+}
+
 TEST(ExecutionEnvironment, givenNeoCalEnabledWhenCreateExecutionEnvironmentThenSetDebugVariables) {
     const std::unordered_map<std::string, int32_t> config = {
         {"UseKmdMigration", 0},
@@ -320,6 +357,7 @@ static_assert(sizeof(ExecutionEnvironment) == sizeof(std::unique_ptr<HardwareInf
                                                   sizeof(std::vector<RootDeviceEnvironment>) +
                                                   sizeof(std::unique_ptr<OsEnvironment>) +
                                                   sizeof(std::unique_ptr<DirectSubmissionController>) +
+                                                  2 * sizeof(std::unique_ptr<ParallelTaskPool>) +
                                                   sizeof(std::unordered_map<uint32_t, uint32_t>) +
                                                   2 * sizeof(bool) +
                                                   sizeof(NEO::DebuggingMode) +
@@ -328,7 +366,7 @@ static_assert(sizeof(ExecutionEnvironment) == sizeof(std::unique_ptr<HardwareInf
                                                   sizeof(std::unordered_map<uint32_t, std::tuple<uint32_t, uint32_t, uint32_t>>) +
                                                   sizeof(std::vector<std::tuple<std::string, uint32_t>>) +
                                                   sizeof(std::unordered_map<std::thread::id, std::string>) +
-                                                  sizeof(std::mutex),
+                                                  3 * sizeof(std::mutex),
               "New members detected in ExecutionEnvironment, please ensure that destruction sequence of objects is correct");
 
 TEST(ExecutionEnvironment, givenExecutionEnvironmentWithVariousMembersWhenItIsDestroyedThenDeleteSequenceIsSpecified) {
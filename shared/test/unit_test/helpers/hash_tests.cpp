@@ -1,14 +1,18 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 
 #include "gtest/gtest.h"
 
+#include <set>
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +38,56 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(Hash128Tests, givenSameDataWhenHashedInOneOrManyChunksThenSameDigestIsReturned) {
+    std::vector<char> data(5000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7 + 3);
+    }
+    const auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1u, 3u, 63u, 64u, 65u, 1000u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish());
+    }
+}
+
+TEST(Hash128Tests, givenDifferentDataWhenHashedThenDifferentDigestsAreReturned) {
+    std::set<std::string> digests;
+    std::vector<char> data(2 * Hash128::stripeSize * Hash128::stripesPerBlock + 1, 'a');
+    for (size_t size = 0; size <= data.size(); size++) {
+        digests.insert(Hash128::hash(data.data(), size).toString());
+    }
+    EXPECT_EQ(data.size() + 1, digests.size());
+
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = 'b';
+        digests.insert(Hash128::hash(data.data(), data.size()).toString());
+        data[i] = 'a';
+    }
+    EXPECT_EQ(2 * data.size() + 1, digests.size());
+}
+
+TEST(Hash128Tests, givenNullOrEmptyDataWhenUpdatingThenDigestIsNotChanged) {
+    Hash128 hash;
+    const auto emptyDigest = hash.finish();
+    hash.update(nullptr, 10);
+    hash.update("abc", 0);
+    EXPECT_EQ(emptyDigest, hash.finish());
+
+    hash.update("abc", 3);
+    EXPECT_NE(emptyDigest, hash.finish());
+
+    hash.reset();
+    EXPECT_EQ(emptyDigest, hash.finish());
+}
+
+TEST(Hash128Tests, givenDigestWhenConvertedToStringThenFixedLengthHexStringIsReturned) {
+    Hash128::Digest digest;
+    digest.high = 0x0123456789abcdefull;
+    digest.low = 0xfull;
+    EXPECT_STREQ("0123456789abcdef000000000000000f", digest.toString().c_str());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,10 @@
 
 using namespace NEO;
 
+namespace NEO {
+struct uint16x8_t;
+} // namespace NEO
+
 using LocalIdTests = ::testing::Test;
 
 HWTEST_F(LocalIdTests, GivenSimd8WhenGettingGrfsPerThreadThenOneIsReturned) {
@@ -133,6 +137,33 @@ TEST(LocalIdTest, givenVariadicGrfSizeWhenLocalSizesAreEmittedThenUseFullRowSize
     EXPECT_EQ(localIdsView[67], 0u);
 }
 
+TEST(LocalIdTest, givenSimd32WhenGeneratingLocalIdsWithCpuSpecificImplementationThenOutputIsBitExactWithSse4Implementation) {
+    const std::array<uint16_t, 3> localSizes[] = {{{1u, 1u, 1u}}, {{7u, 3u, 2u}}, {{32u, 1u, 1u}}, {{33u, 2u, 1u}}, {{17u, 5u, 3u}},
+                                                  {{64u, 4u, 4u}}, {{8u, 8u, 16u}}, {{256u, 4u, 1u}}, {{1024u, 1u, 1u}}};
+
+    for (const auto &localSize : localSizes) {
+        const auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32u, localSize[0] * localSize[1] * localSize[2]));
+        const auto bufferSize = threadsPerWorkGroup * getPerThreadSizeLocalIDs(32u, 32u);
+        auto expectedLocalIds = allocateAlignedMemory(bufferSize, 32);
+        auto localIds = allocateAlignedMemory(bufferSize, 32);
+
+        std::array<uint8_t, 3> dimensionsOrder = {{0u, 1u, 2u}};
+        do {
+            for (auto chooseMaxRowSize : {false, true}) {
+                memset(expectedLocalIds.get(), 0xcd, bufferSize);
+                memset(localIds.get(), 0xcd, bufferSize);
+
+                generateLocalIDsSimd<uint16x8_t, 32>(expectedLocalIds.get(), localSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                LocalIDHelper::generateSimd32(localIds.get(), localSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+
+                EXPECT_EQ(0, memcmp(expectedLocalIds.get(), localIds.get(), bufferSize))
+                    << localSize[0] << "x" << localSize[1] << "x" << localSize[2] << " order " << static_cast<int>(dimensionsOrder[0])
+                    << static_cast<int>(dimensionsOrder[1]) << static_cast<int>(dimensionsOrder[2]) << " maxRow " << chooseMaxRowSize;
+            }
+        } while (std::next_permutation(dimensionsOrder.begin(), dimensionsOrder.end()));
+    }
+}
+
 struct LocalIDFixture : ::testing::TestWithParam<std::tuple<int, int, int, int, int>> {
     void SetUp() override {
         simd = std::get<0>(GetParam());
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,13 +17,30 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 class MockLocalIdsCache : public NEO::LocalIdsCache {
   public:
     using Base = NEO::LocalIdsCache;
     using Base::Base;
+    using Base::allocateLocalIdsBuffer;
     using Base::cache;
+    using Base::getGroupSizeKey;
+    using Base::localIdsBuffers;
+    using Base::trySetLocalIdsFromCache;
     MockLocalIdsCache(size_t cacheSize) : MockLocalIdsCache(cacheSize, 32u){};
     MockLocalIdsCache(size_t cacheSize, uint8_t simd) : Base(cacheSize, {0, 1, 2}, GrfConfig::defaultGrfNumber, simd, 32, false){};
+
+    LocalIdsBuffer *setEntryLocalIds(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, size_t localIdsSize) {
+        auto localIdsBuffer = allocateLocalIdsBuffer(localIdsSize);
+        entry.groupSizeKey = getGroupSizeKey(group);
+        entry.localIdsBuffer = localIdsBuffer;
+        entry.localIdsSize = localIdsSize;
+        return localIdsBuffer;
+    }
 };
 struct LocalIdsCacheFixture {
     void setUp() {
@@ -38,47 +55,143 @@ struct LocalIdsCacheFixture {
 
 using LocalIdsCacheTests = Test<LocalIdsCacheFixture>;
 TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
     localIdsCache->cache[0].accessCounter = 2U;
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
-    EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
-    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter);
+    EXPECT_EQ(localIdsCache->getGroupSizeKey(groupSize), localIdsCache->cache[1].groupSizeKey.load());
+    ASSERT_NE(nullptr, localIdsCache->cache[1].localIdsBuffer.load());
+    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize.load());
+    EXPECT_EQ(2048U, localIdsCache->cache[1].localIdsBuffer.load()->sizeAllocated);
+    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter.load());
+    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter.load());
+    EXPECT_EQ(2U, localIdsCache->cache[1].sequence.load());
+    EXPECT_EQ(0U, localIdsCache->getHitCount());
+    EXPECT_EQ(1U, localIdsCache->getMissCount());
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
+    auto localIdsBuffer = localIdsCache->setEntryLocalIds(localIdsCache->cache[0], groupSize, 1536U);
     localIdsCache->cache[0].accessCounter = 1U;
+    memset(localIdsBuffer->data, 0xA, 1536U);
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter);
+    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter.load());
+    EXPECT_EQ(0xA, perThreadData[1535]);
+    EXPECT_EQ(0, perThreadData[1536]);
+    EXPECT_EQ(1U, localIdsCache->getHitCount());
+    EXPECT_EQ(0U, localIdsCache->getMissCount());
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryBeingModifiedWhenGetLocalIdsForGroupThenEntryIsUsedUnderLock) {
+    localIdsCache->setEntryLocalIds(localIdsCache->cache[0], groupSize, 1536U);
+    localIdsCache->cache[0].sequence = 1U;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter.load());
+    EXPECT_EQ(1U, localIdsCache->cache[0].sequence.load());
+    EXPECT_EQ(1U, localIdsCache->getHitCount());
+    EXPECT_EQ(0U, localIdsCache->getMissCount());
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
+    const auto localIdsBuffer = localIdsCache->setEntryLocalIds(localIdsCache->cache[0], {4, 1, 1}, 512U);
     localIdsCache->cache[0].accessCounter = 2U;
-    const auto localIdsData = localIdsCache->cache[0].localIdsData;
 
     groupSize = {2, 1, 1};
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter);
-    EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
-    EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
-    EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter.load());
+    EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize.load());
+    EXPECT_EQ(512U, localIdsBuffer->sizeAllocated);
+    EXPECT_EQ(localIdsBuffer, localIdsCache->cache[0].localIdsBuffer.load());
+    EXPECT_EQ(1U, localIdsCache->localIdsBuffers.size());
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryWithSmallerBufferAllocatedWhenGetLocalIdsForGroupThenPreviousBufferIsRetiredUntilCacheIsDestroyed) {
+    const auto localIdsBuffer = localIdsCache->setEntryLocalIds(localIdsCache->cache[0], {4, 1, 1}, 192U);
+
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_NE(localIdsBuffer, localIdsCache->cache[0].localIdsBuffer.load());
+    ASSERT_EQ(2U, localIdsCache->localIdsBuffers.size());
+    EXPECT_EQ(localIdsBuffer, localIdsCache->localIdsBuffers[0].get());
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryWithDifferentSizeThanRequestedGroupWhenGetLocalIdsForGroupThenLockFreePathIsRejected) {
+    localIdsCache->setEntryLocalIds(localIdsCache->cache[0], groupSize, 512U);
+    EXPECT_FALSE(localIdsCache->trySetLocalIdsFromCache(localIdsCache->getGroupSizeKey(groupSize), 1536U, perThreadData.data()));
+    EXPECT_EQ(0U, localIdsCache->cache[0].accessCounter.load());
+    EXPECT_EQ(0, perThreadData[0]);
+}
+
+TEST_F(LocalIdsCacheTests, GivenLargerGroupsCommittedConcurrentlyWhenGetLocalIdsForGroupThenReadersGetCorrectDataAndDoNotWritePastRequestedSize) {
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+
+    const Vec3<uint16_t> smallGroupSize = {8, 1, 1};
+    const Vec3<uint16_t> largeGroupSize = {128, 2, 1};
+    const auto smallLocalIdsSize = localIdsCache->getLocalIdsSizeForGroup(smallGroupSize, rootDeviceEnvironment);
+    ASSERT_LT(smallLocalIdsSize, localIdsCache->getLocalIdsSizeForGroup(largeGroupSize, rootDeviceEnvironment));
+
+    std::array<uint8_t, 2048> expectedLocalIds = {0};
+    MockLocalIdsCache referenceLocalIdsCache(1);
+    referenceLocalIdsCache.setLocalIdsForGroup(smallGroupSize, expectedLocalIds.data(), rootDeviceEnvironment);
+
+    constexpr uint8_t guardValue = 0xCD;
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> errors{0u};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            std::array<uint8_t, 2048> localIds;
+            while (!stop.load()) {
+                localIds.fill(guardValue);
+                localIdsCache->setLocalIdsForGroup(smallGroupSize, localIds.data(), rootDeviceEnvironment);
+                if (memcmp(localIds.data(), expectedLocalIds.data(), smallLocalIdsSize) != 0 ||
+                    std::any_of(localIds.begin() + smallLocalIdsSize, localIds.end(), [](uint8_t value) { return value != guardValue; })) {
+                    errors++;
+                }
+            }
+        });
+    }
+
+    std::array<uint8_t, 2048> localIds;
+    for (int i = 0; i < 1000; i++) {
+        localIdsCache->setLocalIdsForGroup(largeGroupSize, localIds.data(), rootDeviceEnvironment);
+        localIdsCache->setLocalIdsForGroup(smallGroupSize, localIds.data(), rootDeviceEnvironment);
+    }
+    stop = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, errors.load());
+}
+
+TEST_F(LocalIdsCacheTests, GivenRepeatedGroupSizesWhenGetLocalIdsForGroupThenFrequentlyUsedEntriesStayInCacheAndCountersAreUpdated) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    EXPECT_EQ(2U, localIdsCache->getCacheSize());
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+
+    const Vec3<uint16_t> hotGroupSize = {8, 1, 1};
+    for (int i = 0; i < 8; i++) {
+        localIdsCache->setLocalIdsForGroup(hotGroupSize, perThreadData.data(), rootDeviceEnvironment);
+    }
+    for (uint16_t i = 1; i <= 4; i++) {
+        localIdsCache->setLocalIdsForGroup({i, 1, 1}, perThreadData.data(), rootDeviceEnvironment);
+    }
+    localIdsCache->setLocalIdsForGroup(hotGroupSize, perThreadData.data(), rootDeviceEnvironment);
+
+    EXPECT_EQ(8U, localIdsCache->getHitCount());
+    EXPECT_EQ(5U, localIdsCache->getMissCount());
 }
 
 TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
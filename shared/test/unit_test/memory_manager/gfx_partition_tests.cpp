@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
@@ -956,3 +957,32 @@ TEST(GfxPartitionTest, givenHeapIndexWhenCheckingIsAnyHeap32ThenTrueIsReturnedFo
         EXPECT_FALSE(GfxPartition::isAnyHeap32(heapsOther[i]));
     }
 }
+
+TEST(GfxPartitionTest, givenSegregatedFitEnabledForSelectedHeapsWhenInitializingGfxPartitionThenOnlySelectedHeapsUseSegregatedFit) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(GfxPartition::isSegregatedFitHeap(HeapIndex::heapInternal));
+
+    debugManager.flags.EnableSegregatedFitGpuVaHeaps.set((1ll << static_cast<uint32_t>(HeapIndex::heapInternal)) | (1ll << static_cast<uint32_t>(HeapIndex::heapStandard)));
+    EXPECT_TRUE(GfxPartition::isSegregatedFitHeap(HeapIndex::heapInternal));
+    EXPECT_TRUE(GfxPartition::isSegregatedFitHeap(HeapIndex::heapStandard));
+    EXPECT_FALSE(GfxPartition::isSegregatedFitHeap(HeapIndex::heapExternal));
+    EXPECT_FALSE(GfxPartition::isSegregatedFitHeap(HeapIndex::heapStandard64KB));
+
+    MockGfxPartition gfxPartition;
+    uint64_t gfxTop = maxNBitValue(48) + 1;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u, gfxTop);
+
+    for (auto heap : {HeapIndex::heapInternal, HeapIndex::heapStandard}) {
+        size_t sizeToAlloc = 3 * MemoryConstants::pageSize64k;
+        auto address = gfxPartition.heapAllocate(heap, sizeToAlloc);
+        EXPECT_NE(0u, address);
+        size_t nextSizeToAlloc = MemoryConstants::pageSize64k;
+        auto nextAddress = gfxPartition.heapAllocate(heap, nextSizeToAlloc);
+        EXPECT_NE(0u, nextAddress);
+        gfxPartition.heapFree(heap, address, sizeToAlloc);
+
+        size_t smallerSizeToAlloc = MemoryConstants::pageSize64k;
+        EXPECT_EQ(address, gfxPartition.heapAllocate(heap, smallerSizeToAlloc));
+        EXPECT_EQ(MemoryConstants::pageSize64k, smallerSizeToAlloc);
+    }
+}
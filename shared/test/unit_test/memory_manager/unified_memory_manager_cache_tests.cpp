@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -200,24 +200,23 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), ++expectedCacheSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache.allocations[i].allocation == testData.allocation) {
-                foundInCache = true;
-                break;
+        for (auto &bucket : svmManager->usmDeviceAllocationsCache.buckets) {
+            for (auto &cachedAllocation : bucket.allocations) {
+                foundInCache |= cachedAllocation.allocation == testData.allocation;
             }
         }
         EXPECT_TRUE(foundInCache);
     }
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenInitializedThenMaxSizeIsSetCorrectly) {
@@ -254,54 +253,54 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         auto recycledAllocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
     }
     {
         auto allocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(allocation);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(allocation2);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         auto recycledAllocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(recycledAllocation);
 
         svmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.totalSize.load());
     }
 }
 
@@ -332,26 +331,26 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenLimitMemoryWastage) {
@@ -373,7 +372,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
 
     svmManager->freeSVMAlloc(allocation);
 
-    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
 
     constexpr auto allowedSizeForReuse = static_cast<size_t>(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization * SVMAllocsManager::SvmAllocationCache::minimalAllocUtilization);
     constexpr auto notAllowedSizeDueToMemoryWastage = allowedSizeForReuse - 1u;
@@ -381,17 +380,17 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
     auto notReusedDueToMemoryWastage = svmManager->createUnifiedMemoryAllocation(notAllowedSizeDueToMemoryWastage, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_NE(notReusedDueToMemoryWastage, allocation);
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
 
     auto reused = svmManager->createUnifiedMemoryAllocation(allowedSizeForReuse, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_EQ(reused, allocation);
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
 
     svmManager->freeSVMAlloc(notReusedDueToMemoryWastage);
     svmManager->freeSVMAlloc(reused);
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingAfterFreeThenDontSaveForReuse) {
@@ -421,7 +420,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingA
 
     svmManager->freeSVMAlloc(allocation);
 
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -450,29 +449,29 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -480,7 +479,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmDeviceAllocationCacheTestDataType {
@@ -551,12 +550,12 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -569,7 +568,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMDeviceAllocCache();
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -595,22 +594,22 @@ TEST_F(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCac
     auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMDeviceAllocCache();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenAllocationWithIsInternalAllocationSetWhenAllocatingAfterFreeThenDoNotReuseAllocation) {
@@ -630,17 +629,17 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationWithIsInternalAllocationSetW
     auto allocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
 
     unifiedMemoryProperties.isInternalAllocation = true;
     auto testedAllocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
     auto svmData = svmManager->getSVMAlloc(testedAllocation);
     EXPECT_NE(nullptr, svmData);
     EXPECT_TRUE(svmData->isInternalAllocation);
 
     svmManager->freeSVMAlloc(testedAllocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
 
     svmManager->trimUSMDeviceAllocCache();
 }
@@ -663,12 +662,12 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheDisabledWhenCheckingIfEna
     auto allocation = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     allocation = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAllocDefer(allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 }
 
 HWTEST_F(SvmHostAllocationCacheTest, givenOclApiSpecificConfigWhenCheckingIfEnabledItIsEnabledIfProductHelperMethodReturnsTrue) {
@@ -726,24 +725,23 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), ++expectedCacheSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmHostAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmHostAllocationsCache.allocations[i].allocation == testData.allocation) {
-                foundInCache = true;
-                break;
+        for (auto &bucket : svmManager->usmHostAllocationsCache.buckets) {
+            for (auto &cachedAllocation : bucket.allocations) {
+                foundInCache |= cachedAllocation.allocation == testData.allocation;
             }
         }
         EXPECT_TRUE(foundInCache);
     }
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenInitializedThenMaxSizeIsSetCorrectly) {
@@ -779,54 +777,54 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize.load());
 
         auto recycledAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
     }
     {
         auto allocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(allocation);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(allocation2);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
-        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
+        EXPECT_EQ(allocationSize, svmManager->usmHostAllocationsCache.totalSize.load());
 
         auto recycledAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
 
         svmManager->freeSVMAllocDefer(recycledAllocation);
 
         svmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize.load());
     }
 }
 
@@ -859,26 +857,26 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenLimitMemoryWastage) {
@@ -899,7 +897,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
 
     svmManager->freeSVMAlloc(allocation);
 
-    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     constexpr auto allowedSizeForReuse = static_cast<size_t>(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization * SVMAllocsManager::SvmAllocationCache::minimalAllocUtilization);
     constexpr auto notAllowedSizeDueToMemoryWastage = allowedSizeForReuse - 1u;
@@ -907,17 +905,17 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     auto notReusedDueToMemoryWastage = svmManager->createHostUnifiedMemoryAllocation(notAllowedSizeDueToMemoryWastage, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_NE(notReusedDueToMemoryWastage, allocation);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     auto reused = svmManager->createHostUnifiedMemoryAllocation(allowedSizeForReuse, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_EQ(reused, allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     svmManager->freeSVMAlloc(notReusedDueToMemoryWastage);
     svmManager->freeSVMAlloc(reused);
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingAfterFreeThenDontSaveForReuse) {
@@ -946,7 +944,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingAft
 
     svmManager->freeSVMAlloc(allocation);
 
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -974,29 +972,29 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -1004,7 +1002,7 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmHostAllocationCacheTestDataType {
@@ -1067,12 +1065,12 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -1085,7 +1083,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMHostAllocCache();
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -1110,21 +1108,21 @@ TEST_F(SvmHostAllocationCacheTest, givenHostOutOfMemoryWhenAllocatingThenCacheIs
     auto allocationInCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMHostAllocCache();
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 } // namespace NEO
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -240,6 +240,40 @@ TEST_F(SVMLocalMemoryAllocatorTest, whenMultiplePointerWithOffsetPassedThenPrope
     svmManager->freeSVMAlloc(ptr2, true);
 }
 
+TEST(SvmAllocationLookupTest, givenRepeatedLookupWhenGettingSvmAllocThenLastLookupIsReusedUntilAnyAllocationIsRemoved) {
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmManager(&memoryManager, false);
+    MockSVMAllocsManager otherSvmManager(&memoryManager, false);
+
+    void *ptr = reinterpret_cast<void *>(0x10000);
+    SvmAllocationData allocationData(1u);
+    allocationData.size = MemoryConstants::pageSize;
+    svmManager.svmAllocs.insert(ptr, allocationData);
+    svmManager.svmAllocs.insert(ptrOffset(ptr, 2 * MemoryConstants::pageSize), allocationData);
+
+    auto svmData = svmManager.getSVMAlloc(ptrOffset(ptr, 16));
+    ASSERT_NE(nullptr, svmData);
+    EXPECT_EQ(svmData, svmManager.lastSvmAllocLookup.svmData);
+    EXPECT_EQ(ptr, svmManager.lastSvmAllocLookup.basePtr);
+
+    // lookup within cached range is served without accessing tracker
+    SvmAllocationData otherAllocationData(1u);
+    svmManager.lastSvmAllocLookup.svmData = &otherAllocationData;
+    EXPECT_EQ(&otherAllocationData, svmManager.getSVMAlloc(ptr));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize)));
+
+    // lookup cache is not shared between managers
+    EXPECT_EQ(nullptr, otherSvmManager.getSVMAlloc(ptr));
+
+    svmManager.getSVMAlloc(ptr);
+    svmManager.lastSvmAllocLookup.svmData = &otherAllocationData;
+    svmManager.svmAllocs.remove(ptrOffset(ptr, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(svmData, svmManager.getSVMAlloc(ptr));
+
+    svmManager.svmAllocs.remove(ptr);
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(ptr));
+}
+
 TEST_F(SVMLocalMemoryAllocatorTest, givenKmdMigratedSharedAllocationWhenPrefetchMemoryIsCalledForMultipleActivePartitionsThenPrefetchAllocationToSubDevices) {
     DebugManagerStateRestore restore;
     debugManager.flags.UseKmdMigration.set(1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,7 +18,11 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 using namespace NEO;
 
 using UnifiedMemoryPoolingStaticTest = ::testing::Test;
@@ -256,6 +260,110 @@ TEST_F(InitializedHostUnifiedMemoryPoolingTest, givenPoolableAllocationWhenGetti
     EXPECT_EQ(nullptr, usmMemAllocPool.getPooledAllocationBasePtr(pastEndPointer));
 }
 
+class ThreadCacheHostUnifiedMemoryPoolingTest : public InitializedHostUnifiedMemoryPoolingTest {
+  public:
+    void SetUp() override {
+        debugManager.flags.EnableUsmPoolThreadCache.set(1);
+        InitializedHostUnifiedMemoryPoolingTest::SetUp();
+    }
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(ThreadCacheHostUnifiedMemoryPoolingTest, givenThreadCacheEnabledWhenAllocatingSmallSizesThenBlocksFromSlabsAreReturnedWithoutTrackingInAllocations) {
+    ASSERT_TRUE(usmMemAllocPool.threadCacheEnabled);
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, 0u, rootDeviceIndices, deviceBitfields);
+
+    auto smallAlloc = usmMemAllocPool.createUnifiedMemoryAllocation(100u, memoryProperties);
+    ASSERT_NE(nullptr, smallAlloc);
+    EXPECT_TRUE(usmMemAllocPool.isInPool(smallAlloc));
+    EXPECT_EQ(nullptr, usmMemAllocPool.allocations.get(smallAlloc));
+    EXPECT_EQ(100u, usmMemAllocPool.getPooledAllocationSize(smallAlloc));
+    EXPECT_EQ(smallAlloc, usmMemAllocPool.getPooledAllocationBasePtr(ptrOffset(smallAlloc, 99u)));
+
+    auto secondSmallAlloc = usmMemAllocPool.createUnifiedMemoryAllocation(100u, memoryProperties);
+    EXPECT_EQ(ptrOffset(smallAlloc, UsmMemAllocPool::chunkAlignment), secondSmallAlloc);
+
+    memoryProperties.alignment = UsmMemAllocPool::maxSlabBlockSize;
+    auto alignedAlloc = usmMemAllocPool.createUnifiedMemoryAllocation(1u, memoryProperties);
+    EXPECT_TRUE(isAligned(alignedAlloc, UsmMemAllocPool::maxSlabBlockSize));
+    EXPECT_EQ(3u, usmMemAllocPool.slabAllocationsCount.load());
+
+    memoryProperties.alignment = 0u;
+    auto bigAlloc = usmMemAllocPool.createUnifiedMemoryAllocation(UsmMemAllocPool::maxSlabBlockSize + 1, memoryProperties);
+    EXPECT_NE(nullptr, usmMemAllocPool.allocations.get(bigAlloc));
+
+    EXPECT_FALSE(usmMemAllocPool.freeSVMAlloc(ptrOffset(smallAlloc, 1u), true));
+    for (auto ptr : {smallAlloc, secondSmallAlloc, alignedAlloc, bigAlloc}) {
+        EXPECT_TRUE(usmMemAllocPool.freeSVMAlloc(ptr, true));
+    }
+    EXPECT_FALSE(usmMemAllocPool.freeSVMAlloc(smallAlloc, true));
+    EXPECT_EQ(0u, usmMemAllocPool.getPooledAllocationSize(smallAlloc));
+    EXPECT_EQ(nullptr, usmMemAllocPool.getPooledAllocationBasePtr(smallAlloc));
+    EXPECT_TRUE(usmMemAllocPool.isEmpty());
+
+    auto reusedAlloc = usmMemAllocPool.createUnifiedMemoryAllocation(100u, memoryProperties);
+    EXPECT_EQ(secondSmallAlloc, reusedAlloc);
+    EXPECT_TRUE(usmMemAllocPool.freeSVMAlloc(reusedAlloc, true));
+}
+
+TEST_F(ThreadCacheHostUnifiedMemoryPoolingTest, givenBlocksFreedByOtherThreadsWhenAllocatingFromMultipleThreadsThenAllBlocksAreReturnedToPool) {
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, 0u, rootDeviceIndices, deviceBitfields);
+    constexpr size_t numThreads = 4u;
+    constexpr size_t numAllocationsPerThread = 64u;
+    constexpr size_t numIterations = 8u;
+
+    std::array<std::vector<void *>, numThreads> allocationsPerThread;
+    std::atomic<size_t> failedAllocations{0u};
+    std::atomic<size_t> failedFrees{0u};
+
+    for (size_t iteration = 0u; iteration < numIterations; iteration++) {
+        // blocks allocated by exited threads in previous iteration are freed remotely, their slabs are reclaimed on demand
+        std::vector<std::thread> freeingThreads;
+        for (size_t threadIndex = 0u; threadIndex < numThreads; threadIndex++) {
+            freeingThreads.emplace_back([&, threadIndex]() {
+                for (auto ptr : allocationsPerThread[threadIndex]) {
+                    if (!usmMemAllocPool.freeSVMAlloc(ptr, true)) {
+                        failedFrees++;
+                    }
+                }
+                allocationsPerThread[threadIndex].clear();
+            });
+        }
+        for (auto &thread : freeingThreads) {
+            thread.join();
+        }
+
+        std::vector<std::thread> allocatingThreads;
+        for (size_t threadIndex = 0u; threadIndex < numThreads; threadIndex++) {
+            allocatingThreads.emplace_back([&, threadIndex]() {
+                for (size_t i = 0u; i < numAllocationsPerThread; i++) {
+                    auto ptr = usmMemAllocPool.createUnifiedMemoryAllocation(1u + (i * 97u) % UsmMemAllocPool::maxSlabBlockSize, memoryProperties);
+                    if (ptr == nullptr) {
+                        failedAllocations++;
+                        continue;
+                    }
+                    allocationsPerThread[threadIndex].push_back(ptr);
+                }
+            });
+        }
+        for (auto &thread : allocatingThreads) {
+            thread.join();
+        }
+        std::rotate(allocationsPerThread.begin(), allocationsPerThread.begin() + 1, allocationsPerThread.end());
+    }
+
+    EXPECT_EQ(0u, failedAllocations.load());
+    EXPECT_EQ(0u, failedFrees.load());
+    EXPECT_EQ(numThreads * numAllocationsPerThread, usmMemAllocPool.slabAllocationsCount.load());
+
+    for (auto &allocations : allocationsPerThread) {
+        for (auto ptr : allocations) {
+            EXPECT_TRUE(usmMemAllocPool.freeSVMAlloc(ptr, true));
+        }
+    }
+    EXPECT_TRUE(usmMemAllocPool.isEmpty());
+}
+
 using InitializationFailedUnifiedMemoryPoolingTest = InitializedUnifiedMemoryPoolingTest<InternalMemoryType::hostUnifiedMemory, true>;
 TEST_F(InitializationFailedUnifiedMemoryPoolingTest, givenNotInitializedPoolWhenUsingPoolThenMethodsSucceed) {
     SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -457,6 +457,45 @@ TEST(DrmBufferObject, givenPerContextVmRequiredWhenBoBoundAndUnboundThenCorrectB
     EXPECT_FALSE(bo.bindInfo[contextId][0]);
 }
 
+TEST(DrmBufferObject, givenBoBoundWhenUnbindingThenResidencyGenerationIsIncremented) {
+    auto executionEnvironment = new ExecutionEnvironment;
+    executionEnvironment->setDebuggingMode(NEO::DebuggingMode::online);
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    executionEnvironment->rootDeviceEnvironments[0]->setHwInfoAndInitHelpers(defaultHwInfo.get());
+    executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+    executionEnvironment->calculateMaxOsContextCount();
+    executionEnvironment->rootDeviceEnvironments[0]->osInterface = std::make_unique<OSInterface>();
+
+    DrmMockNonFailing *drm = new DrmMockNonFailing(*executionEnvironment->rootDeviceEnvironments[0]);
+    EXPECT_TRUE(drm->isPerContextVMRequired());
+
+    executionEnvironment->rootDeviceEnvironments[0]->osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+    executionEnvironment->rootDeviceEnvironments[0]->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, 0u, false);
+
+    std::unique_ptr<Device> device(MockDevice::createWithExecutionEnvironment<MockDevice>(defaultHwInfo.get(), executionEnvironment, 0));
+
+    auto &engines = device->getExecutionEnvironment()->memoryManager->getRegisteredEngines(device->getRootDeviceIndex());
+    auto osContextCount = engines.size();
+    MockBufferObject bo(device->getRootDeviceIndex(), drm, 3, 0, 0, osContextCount);
+
+    EXPECT_EQ(osContextCount, bo.bindInfo.size());
+
+    auto contextId = osContextCount / 2;
+    auto osContext = engines[contextId].osContext;
+    osContext->ensureContextInitialized(false);
+
+    auto initialResidencyGeneration = drm->getResidencyGeneration().load();
+    bo.bind(osContext, 0);
+    EXPECT_EQ(initialResidencyGeneration, drm->getResidencyGeneration().load());
+
+    bo.unbind(osContext, 0);
+    EXPECT_FALSE(bo.bindInfo[contextId][0]);
+    EXPECT_EQ(initialResidencyGeneration + 1, drm->getResidencyGeneration().load());
+
+    bo.unbind(osContext, 0);
+    EXPECT_EQ(initialResidencyGeneration + 1, drm->getResidencyGeneration().load());
+}
+
 TEST(DrmBufferObject, givenPrintBOBindingResultWhenBOBindAndUnbindSucceedsThenPrintDebugInformationAboutBOBindingResult) {
     struct DrmMockToSucceedBindBufferObject : public DrmMock {
         DrmMockToSucceedBindBufferObject(RootDeviceEnvironment &rootDeviceEnvironment)
@@ -699,6 +738,103 @@ TEST(DrmBufferObject, givenDrmWhenUnBindOperationSucceedsThenFenceValueGrow) {
     EXPECT_EQ(drm->fenceVal[0], initFenceValue + 1);
 }
 
+struct DrmBufferObjectBatchedBindingTest : public ::testing::Test {
+    void SetUp() override {
+        auto executionEnvironment = new ExecutionEnvironment;
+        executionEnvironment->setDebuggingMode(NEO::DebuggingMode::online);
+        executionEnvironment->prepareRootDeviceEnvironments(1);
+        executionEnvironment->rootDeviceEnvironments[0]->setHwInfoAndInitHelpers(defaultHwInfo.get());
+        executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+        executionEnvironment->rootDeviceEnvironments[0]->osInterface = std::make_unique<OSInterface>();
+
+        drm = new DrmMock(*executionEnvironment->rootDeviceEnvironments[0]);
+        drm->requirePerContextVM = false;
+        drm->isVMBindImmediateSupported = true;
+        ioctlHelper = new MockIoctlHelper(*drm);
+        ioctlHelper->isWaitBeforeBindRequiredResult = true;
+        drm->ioctlHelper.reset(ioctlHelper);
+
+        executionEnvironment->rootDeviceEnvironments[0]->osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+        executionEnvironment->rootDeviceEnvironments[0]->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, 0u, false);
+        drm->fenceVal[0] = initFenceValue;
+        device.reset(MockDevice::createWithExecutionEnvironment<MockDevice>(defaultHwInfo.get(), executionEnvironment, 0));
+
+        auto &engines = device->getExecutionEnvironment()->memoryManager->getRegisteredEngines(device->getRootDeviceIndex());
+        osContextCount = engines.size();
+        osContext = engines[osContextCount / 2].osContext;
+        for (auto i = 0u; i < 3u; i++) {
+            bos.push_back(std::make_unique<MockBufferObject>(device->getRootDeviceIndex(), drm, 3, 0, 0, osContextCount));
+            bufferObjects.push_back(bos.back().get());
+        }
+    }
+
+    bool isBound(MockBufferObject &bo) {
+        return bo.bindInfo[bo.getOsContextId(osContext)][0];
+    }
+
+    const uint64_t initFenceValue = 10u;
+    DrmMock *drm = nullptr;
+    MockIoctlHelper *ioctlHelper = nullptr;
+    std::unique_ptr<Device> device;
+    OsContext *osContext = nullptr;
+    size_t osContextCount = 0u;
+    std::vector<std::unique_ptr<MockBufferObject>> bos;
+    std::vector<BufferObject *> bufferObjects;
+};
+
+TEST_F(DrmBufferObjectBatchedBindingTest, givenVmBindBatchSupportedWhenBindingBufferObjectsThenSingleBatchedOperationIsUsed) {
+    ioctlHelper->isVmBindBatchSupportedResult = true;
+
+    EXPECT_EQ(0, drm->bindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(1u, ioctlHelper->vmBindBatchCalled);
+    EXPECT_EQ(0u, ioctlHelper->vmBindCalled);
+    EXPECT_EQ(initFenceValue + 1, drm->fenceVal[0]);
+    for (auto &bo : bos) {
+        EXPECT_TRUE(isBound(*bo));
+    }
+
+    EXPECT_EQ(0, drm->bindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(1u, ioctlHelper->vmBindBatchCalled);
+
+    auto initialResidencyGeneration = drm->getResidencyGeneration().load();
+    EXPECT_EQ(0, drm->unbindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(2u, ioctlHelper->vmBindBatchCalled);
+    EXPECT_EQ(0u, ioctlHelper->vmUnbindCalled);
+    EXPECT_NE(initialResidencyGeneration, drm->getResidencyGeneration().load());
+    for (auto &bo : bos) {
+        EXPECT_FALSE(isBound(*bo));
+    }
+}
+
+TEST_F(DrmBufferObjectBatchedBindingTest, givenVmBindBatchNotSupportedWhenBindingBufferObjectsThenEachBufferObjectIsBoundSeparately) {
+    EXPECT_EQ(0, drm->bindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(0u, ioctlHelper->vmBindBatchCalled);
+    EXPECT_EQ(bufferObjects.size(), ioctlHelper->vmBindCalled);
+    EXPECT_EQ(initFenceValue + bufferObjects.size(), drm->fenceVal[0]);
+    for (auto &bo : bos) {
+        EXPECT_TRUE(isBound(*bo));
+    }
+
+    EXPECT_EQ(0, drm->unbindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(bufferObjects.size(), ioctlHelper->vmUnbindCalled);
+    for (auto &bo : bos) {
+        EXPECT_FALSE(isBound(*bo));
+    }
+}
+
+TEST_F(DrmBufferObjectBatchedBindingTest, givenBatchedBindFailsWhenBindingBufferObjectsThenEachBufferObjectIsBoundSeparately) {
+    ioctlHelper->isVmBindBatchSupportedResult = true;
+    ioctlHelper->vmBindBatchResult = -1;
+
+    EXPECT_EQ(0, drm->bindBufferObjects(osContext, 0, bufferObjects));
+    EXPECT_EQ(1u, ioctlHelper->vmBindBatchCalled);
+    EXPECT_EQ(bufferObjects.size(), ioctlHelper->vmBindCalled);
+    EXPECT_EQ(initFenceValue + bufferObjects.size(), drm->fenceVal[0]);
+    for (auto &bo : bos) {
+        EXPECT_TRUE(isBound(*bo));
+    }
+}
+
 TEST(DrmBufferObject, givenDrmWhenUnBindOperationSucceedsAndForceUserFenceUponUnbindAndDisableFenceWaitThenFenceValueGrow) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableUserFenceUponUnbind.set(1);
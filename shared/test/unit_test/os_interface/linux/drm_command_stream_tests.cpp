@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1483,6 +1483,82 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenMergeWithResidencyContaine
     mm->freeGraphicsMemory(commandBuffer);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenIncrementalResidencyEnabledWhenFlushSucceedsThenMergedAllocationsAreMarkedResidentAtCurrentGeneration) {
+    struct MockDrmCsr : public DrmCommandStreamReceiver<FamilyType> {
+        using DrmCommandStreamReceiver<FamilyType>::DrmCommandStreamReceiver;
+        using DrmCommandStreamReceiver<FamilyType>::residencyGeneration;
+        using DrmCommandStreamReceiver<FamilyType>::taskCount;
+        SubmissionStatus flushInternal(const BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override {
+            return SubmissionStatus::success;
+        }
+    };
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIncrementalResidency.set(1);
+    debugManager.flags.CsrDispatchMode.set(static_cast<int32_t>(DispatchMode::immediateDispatch));
+    mock->isVmBindAvailableCall.callParent = false;
+    mock->isVmBindAvailableCall.returnValue = true;
+
+    executionEnvironment->rootDeviceEnvironments[0]->memoryOperationsInterface.reset(new MockMergeResidencyContainerMemoryOperationsHandler(rootDeviceIndex));
+
+    auto &gfxCoreHelper = executionEnvironment->rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>();
+    auto osContext = std::make_unique<OsContextLinux>(*mock, rootDeviceIndex, 0u,
+                                                      EngineDescriptorHelper::getDefaultDescriptor(gfxCoreHelper.getGpgpuEngineInstances(*executionEnvironment->rootDeviceEnvironments[0])[0],
+                                                                                                   PreemptionHelper::getDefaultPreemptionMode(*defaultHwInfo)));
+
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer = BatchBufferHelper::createDefaultBatchBuffer(cs.getGraphicsAllocation(), &cs, cs.getUsed());
+
+    MockDrmCsr mockCsr(*executionEnvironment, rootDeviceIndex, 1, GemCloseWorkerMode::gemCloseWorkerInactive);
+    mockCsr.setupContext(*osContext.get());
+    ASSERT_EQ(&mock->getResidencyGeneration(), mockCsr.residencyGeneration);
+    auto contextId = osContext->getContextId();
+
+    MockGraphicsAllocation residentAllocation;
+    MockGraphicsAllocation newAllocation;
+    mockCsr.makeResident(residentAllocation);
+    EXPECT_EQ(1u, mockCsr.getResidencyAllocations().size());
+
+    auto res = mockCsr.flush(batchBuffer, mockCsr.getResidencyAllocations());
+    EXPECT_EQ(NEO::SubmissionStatus::success, res);
+    EXPECT_EQ(mock->getResidencyGeneration().load(), residentAllocation.getResidencyGeneration(contextId));
+    mockCsr.makeSurfacePackNonResident(mockCsr.getResidencyAllocations(), true);
+
+    mockCsr.taskCount++;
+    mockCsr.makeResident(residentAllocation);
+    mockCsr.makeResident(newAllocation);
+    ASSERT_EQ(1u, mockCsr.getResidencyAllocations().size());
+    EXPECT_EQ(&newAllocation, mockCsr.getResidencyAllocations()[0]);
+    mockCsr.makeSurfacePackNonResident(mockCsr.getResidencyAllocations(), true);
+
+    mock->incrementResidencyGeneration();
+    mockCsr.taskCount++;
+    mockCsr.makeResident(residentAllocation);
+    EXPECT_EQ(1u, mockCsr.getResidencyAllocations().size());
+    mockCsr.makeSurfacePackNonResident(mockCsr.getResidencyAllocations(), true);
+
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenIncrementalResidencyEnabledWithoutVmBindWhenCreatingCsrThenIncrementalResidencyIsNotUsed) {
+    struct MockDrmCsr : public DrmCommandStreamReceiver<FamilyType> {
+        using DrmCommandStreamReceiver<FamilyType>::DrmCommandStreamReceiver;
+        using DrmCommandStreamReceiver<FamilyType>::residencyGeneration;
+    };
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIncrementalResidency.set(1);
+    debugManager.flags.CsrDispatchMode.set(static_cast<int32_t>(DispatchMode::immediateDispatch));
+    mock->isVmBindAvailableCall.callParent = false;
+    mock->isVmBindAvailableCall.returnValue = false;
+
+    MockDrmCsr mockCsr(*executionEnvironment, rootDeviceIndex, 1, GemCloseWorkerMode::gemCloseWorkerInactive);
+    EXPECT_EQ(nullptr, mockCsr.residencyGeneration);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenNoAllocsInMemoryOperationHandlerDefaultWhenFlushThenDrmMemoryOperationHandlerIsNotLocked) {
     struct MockDrmMemoryOperationsHandler : public DrmMemoryOperationsHandler {
         using DrmMemoryOperationsHandler::mutex;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/direct_submission/direct_submission_trace.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
@@ -26,12 +27,14 @@
 #include "shared/test/common/helpers/dispatch_flags_helper.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/linux/drm_mock.h"
 #include "shared/test/common/mocks/linux/mock_drm_allocation.h"
 #include "shared/test/common/mocks/linux/mock_drm_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_gmm.h"
 #include "shared/test/common/mocks/mock_gmm_page_table_mngr.h"
+#include "shared/test/common/mocks/mock_io_functions.h"
 #include "shared/test/common/mocks/mock_submissions_aggregator.h"
 #include "shared/test/common/os_interface/linux/drm_command_stream_fixture.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -926,6 +929,33 @@ HWTEST_TEMPLATED_F(DrmCommandStreamBlitterDirectSubmissionTest, givenBlitterDire
     EXPECT_NE(NEO::SubmissionStatus::success, res);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamDirectSubmissionTest, givenDirectSubmissionTraceEnabledWhenCsrDetectsGpuHangThenGpuHangTraceIsDumpedOnce) {
+    debugManager.flags.DirectSubmissionTraceEntries.set(8);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    testedCsr->directSubmission = std::make_unique<DrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>>>(*csr);
+
+    const auto traceFileSize = sizeof(DirectSubmissionTraceFileHeader);
+    auto fileBuffer = std::make_unique<char[]>(traceFileSize);
+    VariableBackup<size_t> mockFwriteReturnBackup(&IoFunctions::mockFwriteReturn, traceFileSize);
+    VariableBackup<char *> mockFwriteBufferBackup(&IoFunctions::mockFwriteBuffer, fileBuffer.get());
+    auto mockFopenCalledBefore = IoFunctions::mockFopenCalled;
+
+    mock->checkResetStatusReturnValue = false;
+    EXPECT_FALSE(csr->isGpuHangDetected());
+    EXPECT_EQ(mockFopenCalledBefore, IoFunctions::mockFopenCalled);
+
+    mock->checkResetStatusReturnValue = true;
+    EXPECT_TRUE(csr->isGpuHangDetected());
+    EXPECT_EQ(mockFopenCalledBefore + 1, IoFunctions::mockFopenCalled);
+
+    DirectSubmissionTraceFileHeader header = {};
+    memcpy_s(&header, sizeof(header), fileBuffer.get(), sizeof(header));
+    EXPECT_EQ(DirectSubmissionTrace::fileMagic, header.magic);
+
+    EXPECT_TRUE(csr->isGpuHangDetected());
+    EXPECT_EQ(mockFopenCalledBefore + 1, IoFunctions::mockFopenCalled);
+}
+
 template <typename GfxFamily>
 struct MockDrmDirectSubmission : public DrmDirectSubmission<GfxFamily, RenderDispatcher<GfxFamily>> {
     using DrmDirectSubmission<GfxFamily, RenderDispatcher<GfxFamily>>::currentTagData;
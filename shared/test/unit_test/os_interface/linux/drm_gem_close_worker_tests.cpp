@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -166,24 +167,76 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct MockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<MockDrmGemCloseWorker> worker(new MockDrmGemCloseWorker(*mm));
-    EXPECT_NE(nullptr, worker->thread);
+    EXPECT_EQ(1u, worker->threads.size());
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
 }
 
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenThreadIsClosed) {
     struct MockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<MockDrmGemCloseWorker> worker(new MockDrmGemCloseWorker(*mm));
     worker->close(true);
     worker->close(true);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleWorkerThreadsWhenBufferObjectsArePushedFromMultipleThreadsThenAllAreClosed) {
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::threads;
+    };
+
+    constexpr int numProducers = 4;
+    constexpr int numBosPerProducer = 64;
+    this->drmMock->gemCloseExpected = numProducers * numBosPerProducer;
+
+    auto worker = std::make_unique<MockDrmGemCloseWorker>(*mm, 3u);
+    EXPECT_EQ(3u, worker->threads.size());
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < numProducers; i++) {
+        producers.emplace_back([&]() {
+            for (int j = 0; j < numBosPerProducer; j++) {
+                worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    worker->close(true);
+    EXPECT_TRUE(worker->isEmpty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsClosedByWorkerWhenGettingStatisticsThenClosedCountAndQueueDepthAreReported) {
+    this->drmMock->gemCloseExpected = 3;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    auto statistics = worker->getStatistics();
+    EXPECT_EQ(0u, statistics.closedCount);
+    EXPECT_EQ(0u, statistics.maxQueueDepth);
+
+    for (int i = 0; i < 3; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    }
+    EXPECT_LE(worker->getQueueDepth(), 3u);
+
+    worker->close(true);
+
+    statistics = worker->getStatistics();
+    EXPECT_EQ(0u, worker->getQueueDepth());
+    EXPECT_EQ(3u, statistics.closedCount);
+    EXPECT_GE(statistics.maxQueueDepth, 1u);
+    EXPECT_LE(statistics.maxQueueDepth, 3u);
+    EXPECT_GE(statistics.totalCloseLatencyNs, statistics.maxCloseLatencyNs);
 }
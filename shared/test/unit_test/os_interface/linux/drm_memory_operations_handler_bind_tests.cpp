@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -444,6 +444,35 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenRunningOutOfMemoryThenUnusedAlloc
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingEnabledWhenMakingResidentAndRunningOutOfMemoryThenAllocationsAreBoundAndUnusedAreUnbound) {
+    debugManager.flags.EnableVmBindBatching.set(1);
+    GraphicsAllocation *allocations[] = {
+        memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}),
+        memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize})};
+
+    for (auto engines : {&device->getAllEngines(), &device->getSubDevice(0u)->getAllEngines(), &device->getSubDevice(1u)->getAllEngines()}) {
+        for (auto &engine : *engines) {
+            *engine.commandStreamReceiver->getTagAddress() = 10;
+            for (auto &allocation : allocations) {
+                allocation->updateTaskCount(8u, engine.osContext->getContextId());
+            }
+            EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(allocations), true), MemoryOperationsStatus::success);
+        }
+    }
+    *device->getSubDevice(1u)->getDefaultEngine().commandStreamReceiver->getTagAddress() = 5;
+
+    EXPECT_EQ(mock->context.vmBindCalled, 4u);
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    EXPECT_EQ(mock->context.vmBindCalled, 4u);
+    EXPECT_EQ(mock->context.vmUnbindCalled, 2u);
+
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWhenEvictUnusedThenNothingIsUnbound) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1636,6 +1636,95 @@ TEST_F(IoctlHelperXeFenceWaitTest, whenCallingVmBindThenWaitUserFenceIsCalled) {
     }
 }
 
+TEST_F(IoctlHelperXeFenceWaitTest, whenCallingVmBindBatchThenSingleIoctlWithArrayOfBindsAndSingleFenceWaitIsUsed) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+    EXPECT_TRUE(xeIoctlHelper->isVmBindBatchSupported());
+
+    uint64_t fenceAddress = 0x4321;
+    uint64_t fenceValue = 0x789;
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+    mockBindInfo.handle = 0x1235;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, fenceValue, 0u);
+
+    std::vector<VmBindParams> vmBindParams(2u);
+    for (auto i = 0u; i < vmBindParams.size(); i++) {
+        vmBindParams[i].vmId = 7u;
+        vmBindParams[i].handle = 0x1234 + i;
+        vmBindParams[i].start = 0x10000 * (i + 1);
+        vmBindParams[i].length = 0x1000;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams[i], vmBindExtUserFence);
+    }
+
+    drm->vmBindInputs.clear();
+    drm->vmBindOpsInputs.clear();
+    drm->syncInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBindBatch(vmBindParams, true));
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(7u, drm->vmBindInputs[0].vm_id);
+    EXPECT_EQ(2u, drm->vmBindInputs[0].num_binds);
+    ASSERT_EQ(2u, drm->vmBindOpsInputs.size());
+    for (auto i = 0u; i < vmBindParams.size(); i++) {
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindOpsInputs[i].op);
+        EXPECT_EQ(vmBindParams[i].handle, drm->vmBindOpsInputs[i].obj);
+        EXPECT_EQ(vmBindParams[i].start, drm->vmBindOpsInputs[i].addr);
+        EXPECT_EQ(vmBindParams[i].length, drm->vmBindOpsInputs[i].range);
+    }
+    ASSERT_EQ(1u, drm->syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm->syncInputs[0].addr);
+    EXPECT_EQ(fenceValue, drm->syncInputs[0].timeline_value);
+    ASSERT_EQ(1u, drm->waitUserFenceInputs.size());
+    EXPECT_EQ(fenceValue, drm->waitUserFenceInputs[0].value);
+
+    drm->vmBindInputs.clear();
+    drm->vmBindOpsInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBindBatch(vmBindParams, false));
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    ASSERT_EQ(2u, drm->vmBindOpsInputs.size());
+    for (auto &bindOp : drm->vmBindOpsInputs) {
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), bindOp.op);
+        EXPECT_EQ(0u, bindOp.obj);
+    }
+    EXPECT_EQ(1u, drm->waitUserFenceInputs.size());
+}
+
+TEST_F(IoctlHelperXeFenceWaitTest, givenUnknownBufferObjectInBatchWhenCallingVmBindBatchThenErrorIsReturnedWithoutIoctl) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    std::vector<VmBindParams> vmBindParams(2u);
+    vmBindParams[0].handle = 0x1234;
+    vmBindParams[1].handle = 0x5678;
+    for (auto &vmBind : vmBindParams) {
+        xeIoctlHelper->setVmBindUserFence(vmBind, vmBindExtUserFence);
+    }
+
+    drm->vmBindInputs.clear();
+    EXPECT_EQ(-1, xeIoctlHelper->vmBindBatch(vmBindParams, true));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+}
+
 TEST(IoctlHelperXeTest, givenVmBindWaitUserFenceTimeoutWhenCallingVmBindThenWaitUserFenceIsCalledWithSpecificTimeout) {
     DebugManagerStateRestore restorer;
     debugManager.flags.VmBindWaitUserFenceTimeout.set(5000000000ll);
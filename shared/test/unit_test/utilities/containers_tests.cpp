@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -659,6 +659,44 @@ TEST(IDList, GivenNonThreadSafeWhenDetachingNodesThenResultIsCorrect) {
     iDListTestDetachNodes<false>();
 }
 
+template <bool threadSafe>
+void iDListTestDetachFrontNodes() {
+    IDList<DummyDNode, threadSafe, false, false> list;
+
+    DummyDNode nodes[5];
+    for (auto &node : nodes) {
+        list.pushTailOne(node);
+    }
+
+    size_t count = 2;
+    auto detached = list.detachFrontNodes(count);
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(&nodes[0], detached);
+    ASSERT_EQ(&nodes[1], detached->next);
+    ASSERT_EQ(nullptr, nodes[1].next);
+    ASSERT_EQ(&nodes[2], list.peekHead());
+    ASSERT_EQ(nullptr, nodes[2].prev);
+
+    count = 10;
+    detached = list.detachFrontNodes(count);
+    ASSERT_EQ(3u, count);
+    ASSERT_EQ(&nodes[2], detached);
+    ASSERT_TRUE(list.peekIsEmpty());
+    ASSERT_EQ(nullptr, list.peekTail());
+
+    count = 1;
+    ASSERT_EQ(nullptr, list.detachFrontNodes(count));
+    ASSERT_EQ(0u, count);
+}
+
+TEST(IDList, GivenThreadSafeWhenDetachingFrontNodesThenRequestedNumberOfNodesIsDetached) {
+    iDListTestDetachFrontNodes<true>();
+}
+
+TEST(IDList, GivenNonThreadSafeWhenDetachingFrontNodesThenRequestedNumberOfNodesIsDetached) {
+    iDListTestDetachFrontNodes<false>();
+}
+
 template <bool threadSafe>
 void iDListTestRemoveOne() {
     IDList<DummyDNode, threadSafe, false, false> list;
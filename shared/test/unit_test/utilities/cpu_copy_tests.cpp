@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/source/utilities/parallel_task_pool.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0u; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7u + 3u);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyTest, givenMisalignedPointersAndVariousSizesWhenCopyingNonTemporalThenOnlyRequestedRangeIsCopied) {
+    const size_t sizes[] = {0u, 1u, 15u, 16u, 63u, 64u, 65u, 130u, 4096u + 17u};
+    const size_t offsets[] = {0u, 1u, 8u, 15u};
+    const size_t guardSize = 64u;
+
+    for (auto size : sizes) {
+        for (auto dstOffset : offsets) {
+            for (auto srcOffset : offsets) {
+                auto src = createPattern(size + srcOffset);
+                std::vector<uint8_t> dst(size + dstOffset + guardSize, 0xffu);
+
+                CpuCopy::copyNonTemporal(dst.data() + dstOffset, src.data() + srcOffset, size);
+
+                for (size_t i = 0u; i < dstOffset; i++) {
+                    EXPECT_EQ(0xffu, dst[i]);
+                }
+                EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size));
+                for (size_t i = dstOffset + size; i < dst.size(); i++) {
+                    EXPECT_EQ(0xffu, dst[i]);
+                }
+            }
+        }
+    }
+}
+
+TEST(CpuCopyTest, givenTaskPoolAndSizeNotMultipleOfChunkSizeWhenCopyingThenWholeRangeIsCopied) {
+    ParallelTaskPool taskPool(3u);
+    const size_t size = 10 * 1024u + 33u;
+    auto src = createPattern(size);
+
+    for (auto nonTemporal : {false, true}) {
+        std::vector<uint8_t> dst(size + 1, 0u);
+        CpuCopy::copy(dst.data() + 1, src.data(), size, nonTemporal, &taskPool, 1000u);
+        EXPECT_EQ(0u, dst[0]);
+        EXPECT_EQ(0, memcmp(dst.data() + 1, src.data(), size));
+    }
+}
+
+TEST(CpuCopyTest, givenNoTaskPoolWhenCopyingThenWholeRangeIsCopiedByCallingThread) {
+    const size_t size = 4096u + 5u;
+    auto src = createPattern(size);
+
+    for (auto nonTemporal : {false, true}) {
+        std::vector<uint8_t> dst(size, 0u);
+        CpuCopy::copy(dst.data(), src.data(), size, nonTemporal, nullptr, 64u);
+        EXPECT_EQ(src, dst);
+    }
+}
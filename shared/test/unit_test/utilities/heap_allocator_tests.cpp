@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <map>
 #include <random>
 
 using namespace NEO;
@@ -21,6 +22,7 @@ const size_t allocationAlignment = MemoryConstants::pageSize;
 
 class HeapAllocatorUnderTest : public HeapAllocator {
   public:
+    HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment, size_t threshold, bool segregatedFit) : HeapAllocator(address, size, alignment, threshold, segregatedFit) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment, size_t threshold) : HeapAllocator(address, size, alignment, threshold) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment) : HeapAllocator(address, size, alignment) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size) : HeapAllocator(address, size) {}
@@ -40,6 +42,8 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
+    using HeapAllocator::segregatedChunksBig;
+    using HeapAllocator::segregatedChunksSmall;
     size_t sizeOfFreedChunk = 0;
 };
 
@@ -1472,3 +1476,140 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorSegregatedFitTest, givenSegregatedFitWhenCreatingHeapAllocatorThenFreeChunkVectorsAreNotUsed) {
+    HeapAllocatorUnderTest linearScanAllocator(0x100000llu, 1024u * 4096u, allocationAlignment, sizeThreshold);
+    EXPECT_FALSE(linearScanAllocator.isSegregatedFit());
+    EXPECT_EQ(nullptr, linearScanAllocator.segregatedChunksSmall);
+    EXPECT_EQ(nullptr, linearScanAllocator.segregatedChunksBig);
+
+    HeapAllocatorUnderTest segregatedFitAllocator(0x100000llu, 1024u * 4096u, allocationAlignment, sizeThreshold, true);
+    EXPECT_TRUE(segregatedFitAllocator.isSegregatedFit());
+    EXPECT_NE(nullptr, segregatedFitAllocator.segregatedChunksSmall);
+    EXPECT_NE(nullptr, segregatedFitAllocator.segregatedChunksBig);
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenNeighbouringChunksFreedWhenUsingSegregatedFitThenChunksAreCoalescedAndMergedWithBound) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0u, true);
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t ptrSize = 2 * MemoryConstants::pageSize;
+        ptr = heapAllocator.allocate(ptrSize);
+        EXPECT_NE(0llu, ptr);
+    }
+    EXPECT_EQ(heapBase + 8 * MemoryConstants::pageSize, heapAllocator.getLeftBound());
+
+    heapAllocator.free(ptrs[1], 2 * MemoryConstants::pageSize);
+    heapAllocator.free(ptrs[2], 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(1u, heapAllocator.segregatedChunksBig->getNumChunks());
+    EXPECT_EQ(4 * MemoryConstants::pageSize, heapAllocator.segregatedChunksBig->getFreeSize());
+    EXPECT_TRUE(heapAllocator.getFreedChunksBig().empty());
+
+    heapAllocator.free(ptrs[3], 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(0u, heapAllocator.segregatedChunksBig->getNumChunks());
+    EXPECT_EQ(ptrs[1], heapAllocator.getLeftBound());
+    EXPECT_EQ(heapSize - 2 * MemoryConstants::pageSize, heapAllocator.getavailableSize());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenFreedChunkBiggerThanAllocationWhenUsingSegregatedFitThenOnlyRequestedSizeIsTakenFromChunk) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, true);
+
+    size_t ptrSize = 8 * MemoryConstants::pageSize;
+    auto ptr1 = heapAllocator.allocate(ptrSize);
+    auto ptr2 = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(ptr1 - ptrSize, ptr2);
+    EXPECT_EQ(ptr2, heapAllocator.getRightBound());
+
+    heapAllocator.free(ptr1, ptrSize);
+    EXPECT_EQ(1u, heapAllocator.segregatedChunksSmall->getNumChunks());
+
+    size_t smallerSize = 3 * MemoryConstants::pageSize;
+    auto ptr3 = heapAllocator.allocate(smallerSize);
+    EXPECT_EQ(ptr1, ptr3);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, smallerSize);
+    EXPECT_EQ(5 * MemoryConstants::pageSize, heapAllocator.segregatedChunksSmall->getFreeSize());
+    EXPECT_EQ(heapSize - ptrSize - smallerSize, heapAllocator.getavailableSize());
+
+    heapAllocator.free(ptr3, smallerSize);
+    heapAllocator.free(ptr2, ptrSize);
+    EXPECT_EQ(0u, heapAllocator.segregatedChunksSmall->getNumChunks());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+    EXPECT_EQ(heapSize, heapAllocator.getavailableSize());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenUnalignedFreedChunkWhenAllocatingWithCustomAlignmentUsingSegregatedFitThenAlignedPartOfChunkIsUsed) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0u, true);
+
+    size_t ptrSize = MemoryConstants::pageSize;
+    heapAllocator.allocate(ptrSize);
+    ptrSize = 64 * MemoryConstants::pageSize;
+    const uint64_t freeChunkAddress = heapAllocator.allocate(ptrSize);
+    heapAllocator.allocate(ptrSize);
+    heapAllocator.free(freeChunkAddress, ptrSize);
+    const auto leftBound = heapAllocator.getLeftBound();
+
+    const size_t customAlignment = 16 * MemoryConstants::pageSize;
+    size_t alignedSize = 16 * MemoryConstants::pageSize;
+    auto ptr = heapAllocator.allocateWithCustomAlignment(alignedSize, customAlignment);
+    EXPECT_EQ(alignUp(freeChunkAddress, customAlignment), ptr);
+    EXPECT_EQ(leftBound, heapAllocator.getLeftBound());
+    EXPECT_EQ(2u, heapAllocator.segregatedChunksBig->getNumChunks());
+    EXPECT_EQ(48 * MemoryConstants::pageSize, heapAllocator.segregatedChunksBig->getFreeSize());
+
+    heapAllocator.free(ptr, alignedSize);
+    EXPECT_EQ(1u, heapAllocator.segregatedChunksBig->getNumChunks());
+    EXPECT_EQ(64 * MemoryConstants::pageSize, heapAllocator.segregatedChunksBig->getFreeSize());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenRandomAllocationsAndFreesWhenUsingEitherFreeListModeThenAllocationsDoNotOverlapAndWholeHeapIsRecovered) {
+    const uint64_t heapBase = 0x100000000llu;
+    const size_t heapSize = 256 * MemoryConstants::megaByte;
+    const size_t bigThreshold = 64 * MemoryConstants::pageSize;
+
+    for (auto segregatedFit : {false, true}) {
+        HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, bigThreshold, segregatedFit);
+        std::ranlux24 generator(1);
+        std::map<uint64_t, size_t> allocations;
+
+        for (uint32_t i = 0; i < 20000; i++) {
+            if (allocations.size() >= 256 || (!allocations.empty() && generator() % 2 == 0)) {
+                auto it = allocations.begin();
+                std::advance(it, generator() % allocations.size());
+                heapAllocator.free(it->first, it->second);
+                allocations.erase(it);
+                continue;
+            }
+
+            size_t ptrSize = (1 + generator() % 64) * MemoryConstants::pageSize;
+            const size_t alignment = (generator() % 8 == 0) ? MemoryConstants::pageSize64k : 0u;
+            auto ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, alignment);
+            ASSERT_NE(0llu, ptr);
+            EXPECT_TRUE(isAligned(ptr, std::max(alignment, allocationAlignment)));
+
+            auto next = allocations.lower_bound(ptr);
+            if (next != allocations.end()) {
+                ASSERT_LE(ptr + ptrSize, next->first);
+            }
+            if (next != allocations.begin()) {
+                auto previous = std::prev(next);
+                ASSERT_LE(previous->first + previous->second, ptr);
+            }
+            allocations.emplace(ptr, ptrSize);
+        }
+
+        for (auto &[ptr, ptrSize] : allocations) {
+            heapAllocator.free(ptr, ptrSize);
+        }
+        EXPECT_EQ(heapSize, heapAllocator.getavailableSize());
+
+        size_t wholeHeapSize = heapSize;
+        EXPECT_EQ(heapBase, heapAllocator.allocate(wholeHeapSize));
+    }
+}
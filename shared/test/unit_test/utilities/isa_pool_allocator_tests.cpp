@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,3 +99,77 @@ TEST_F(IsaPoolAllocatorTest, givenIsaPoolAllocatorWhenRequestForLargeAllocationT
     verifySharedIsaAllocation(allocation, 0, requestAllocationSize);
     isaAllocator.freeSharedIsaAllocation(allocation);
 }
+
+TEST_F(IsaPoolAllocatorTest, givenIdenticalIsaImagesWhenRequestingDeduplicatedIsaThenChunkIsSharedAndReleasedByLastUser) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t isaSize = MemoryConstants::pageSize;
+
+    auto firstAllocation = isaAllocator.requestDeduplicatedIsa(false, std::vector<uint8_t>(isaSize, 0xAB));
+    verifySharedIsaAllocation(firstAllocation, 0ul, isaSize);
+    ASSERT_NE(nullptr, firstAllocation->getDeduplicatedIsa());
+    EXPECT_FALSE(firstAllocation->getDeduplicatedIsa()->uploaded.load());
+    firstAllocation->getDeduplicatedIsa()->uploaded.store(true);
+
+    auto secondAllocation = isaAllocator.requestDeduplicatedIsa(false, std::vector<uint8_t>(isaSize, 0xAB));
+    verifySharedIsaAllocation(secondAllocation, 0ul, isaSize);
+    EXPECT_NE(firstAllocation, secondAllocation);
+    EXPECT_EQ(firstAllocation->getGraphicsAllocation(), secondAllocation->getGraphicsAllocation());
+    EXPECT_EQ(firstAllocation->getDeduplicatedIsa(), secondAllocation->getDeduplicatedIsa());
+    EXPECT_EQ(2u, secondAllocation->getDeduplicatedIsa()->refCount);
+    EXPECT_TRUE(secondAllocation->getDeduplicatedIsa()->uploaded.load());
+    EXPECT_EQ(1u, isaAllocator.getNumDeduplicatedIsas());
+
+    isaAllocator.freeSharedIsaAllocation(firstAllocation);
+    EXPECT_EQ(1u, isaAllocator.getNumDeduplicatedIsas());
+
+    // chunk is still in use, so it can't be handed out to other users
+    auto otherAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, isaSize);
+    verifySharedIsaAllocation(otherAllocation, isaSize, isaSize);
+
+    isaAllocator.freeSharedIsaAllocation(secondAllocation);
+    EXPECT_EQ(0u, isaAllocator.getNumDeduplicatedIsas());
+
+    auto reallocatedAllocation = isaAllocator.requestDeduplicatedIsa(false, std::vector<uint8_t>(isaSize, 0xAB));
+    ASSERT_NE(nullptr, reallocatedAllocation);
+    EXPECT_FALSE(reallocatedAllocation->getDeduplicatedIsa()->uploaded.load());
+
+    isaAllocator.freeSharedIsaAllocation(reallocatedAllocation);
+    isaAllocator.freeSharedIsaAllocation(otherAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenDifferentIsaImagesOrIsaTypesWhenRequestingDeduplicatedIsaThenSeparateChunksAreUsed) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t isaSize = MemoryConstants::pageSize;
+
+    auto isaImage = std::vector<uint8_t>(isaSize, 0xAB);
+    auto modifiedIsaImage = isaImage;
+    modifiedIsaImage[isaSize - 1] = 0xCD;
+
+    auto userAllocation = isaAllocator.requestDeduplicatedIsa(false, std::vector<uint8_t>(isaImage));
+    auto builtinAllocation = isaAllocator.requestDeduplicatedIsa(true, std::vector<uint8_t>(isaImage));
+    auto modifiedAllocation = isaAllocator.requestDeduplicatedIsa(false, std::move(modifiedIsaImage));
+    auto shorterAllocation = isaAllocator.requestDeduplicatedIsa(false, std::vector<uint8_t>(isaSize / 2, 0xAB));
+
+    verifySharedIsaAllocation(userAllocation, 0ul, isaSize);
+    verifySharedIsaAllocation(builtinAllocation, 0ul, isaSize);
+    verifySharedIsaAllocation(modifiedAllocation, isaSize, isaSize);
+    verifySharedIsaAllocation(shorterAllocation, 2 * isaSize, isaSize / 2);
+    EXPECT_NE(userAllocation->getGraphicsAllocation(), builtinAllocation->getGraphicsAllocation());
+    EXPECT_EQ(4u, isaAllocator.getNumDeduplicatedIsas());
+
+    for (auto allocation : {userAllocation, builtinAllocation, modifiedAllocation, shorterAllocation}) {
+        EXPECT_EQ(1u, allocation->getDeduplicatedIsa()->refCount);
+        isaAllocator.freeSharedIsaAllocation(allocation);
+    }
+    EXPECT_EQ(0u, isaAllocator.getNumDeduplicatedIsas());
+}
+
+TEST_F(IsaPoolAllocatorTest, givenRegularSharedIsaAllocationThenItIsNotDeduplicated) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+
+    auto allocation = isaAllocator.requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(nullptr, allocation->getDeduplicatedIsa());
+    EXPECT_EQ(0u, isaAllocator.getNumDeduplicatedIsas());
+    isaAllocator.freeSharedIsaAllocation(allocation);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/parallel_task_pool.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelTaskPoolTest, givenWorkersWhenRunningTasksThenEachTaskIsExecutedExactlyOnce) {
+    ParallelTaskPool taskPool(3u);
+    EXPECT_EQ(3u, taskPool.getNumWorkers());
+
+    std::vector<std::atomic<uint32_t>> executionCounts(1000u);
+    taskPool.run(executionCounts.size(), [&](size_t taskId) {
+        executionCounts[taskId]++;
+    });
+
+    for (auto &executionCount : executionCounts) {
+        EXPECT_EQ(1u, executionCount.load());
+    }
+}
+
+TEST(ParallelTaskPoolTest, givenTasksWritingOwnOutputsWhenRunningRepeatedlyThenResultsAreSameAsSerialExecution) {
+    ParallelTaskPool taskPool(4u);
+
+    std::vector<uint64_t> expectedOutputs(257u);
+    for (size_t taskId = 0u; taskId < expectedOutputs.size(); taskId++) {
+        expectedOutputs[taskId] = taskId * taskId + 7u;
+    }
+
+    for (uint32_t iteration = 0u; iteration < 50u; iteration++) {
+        std::vector<uint64_t> outputs(expectedOutputs.size(), 0u);
+        taskPool.run(outputs.size(), [&](size_t taskId) {
+            outputs[taskId] = taskId * taskId + 7u;
+        });
+        EXPECT_EQ(expectedOutputs, outputs);
+    }
+}
+
+TEST(ParallelTaskPoolTest, givenThreadCreationFailsWhenRunningTasksThenTasksAreExecutedInlineInOrder) {
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+    ParallelTaskPool taskPool(4u);
+    EXPECT_EQ(0u, taskPool.getNumWorkers());
+
+    const auto callerThreadId = std::this_thread::get_id();
+    std::vector<size_t> executionOrder;
+    taskPool.run(5u, [&](size_t taskId) {
+        EXPECT_EQ(callerThreadId, std::this_thread::get_id());
+        executionOrder.push_back(taskId);
+    });
+
+    std::vector<size_t> expectedOrder = {0u, 1u, 2u, 3u, 4u};
+    EXPECT_EQ(expectedOrder, executionOrder);
+}
+
+TEST(ParallelTaskPoolTest, givenRunCalledFromWithinTaskWhenRunningThenNestedTasksAreExecutedInlineByCurrentThread) {
+    ParallelTaskPool taskPool(2u);
+
+    std::vector<std::vector<size_t>> nestedOutputs(8u);
+    std::atomic<uint32_t> nestedOnOtherThread{0u};
+    taskPool.run(nestedOutputs.size(), [&](size_t taskId) {
+        const auto taskThreadId = std::this_thread::get_id();
+        taskPool.run(3u, [&](size_t nestedTaskId) {
+            if (taskThreadId != std::this_thread::get_id()) {
+                nestedOnOtherThread++;
+            }
+            nestedOutputs[taskId].push_back(nestedTaskId);
+        });
+    });
+
+    EXPECT_EQ(0u, nestedOnOtherThread.load());
+    std::vector<size_t> expectedNestedOutput = {0u, 1u, 2u};
+    for (auto &nestedOutput : nestedOutputs) {
+        EXPECT_EQ(expectedNestedOutput, nestedOutput);
+    }
+}
+
+TEST(ParallelTaskPoolTest, givenNoTasksWhenRunningThenTaskIsNotCalled) {
+    ParallelTaskPool taskPool(2u);
+
+    bool called = false;
+    taskPool.run(0u, [&](size_t taskId) { called = true; });
+    EXPECT_FALSE(called);
+}
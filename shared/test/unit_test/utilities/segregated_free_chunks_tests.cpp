@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/segregated_free_chunks.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+TEST(SegregatedFreeChunksTest, givenSizesWhenGettingSizeClassThenClassesAreOrderedAndEachPowerOfTwoRangeIsSplitLinearly) {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+
+    SegregatedFreeChunks::getSizeClass(5u, firstLevel, secondLevel);
+    EXPECT_EQ(0u, firstLevel);
+    EXPECT_EQ(5u, secondLevel);
+
+    SegregatedFreeChunks::getSizeClass(MemoryConstants::pageSize, firstLevel, secondLevel);
+    EXPECT_EQ(9u, firstLevel);
+    EXPECT_EQ(0u, secondLevel);
+
+    SegregatedFreeChunks::getSizeClass(MemoryConstants::pageSize + MemoryConstants::pageSize / 2, firstLevel, secondLevel);
+    EXPECT_EQ(9u, firstLevel);
+    EXPECT_EQ(SegregatedFreeChunks::secondLevelCount / 2, secondLevel);
+
+    SegregatedFreeChunks::getSizeClass(std::numeric_limits<size_t>::max(), firstLevel, secondLevel);
+    EXPECT_EQ(SegregatedFreeChunks::firstLevelCount - 1, firstLevel);
+    EXPECT_EQ(SegregatedFreeChunks::secondLevelCount - 1, secondLevel);
+}
+
+TEST(SegregatedFreeChunksTest, givenAdjacentChunksStoredWhenStoringThenChunksAreCoalesced) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.store(0x10000u, 0x1000u);
+    freeChunks.store(0x12000u, 0x1000u);
+    EXPECT_EQ(2u, freeChunks.getNumChunks());
+
+    freeChunks.store(0x11000u, 0x1000u);
+    EXPECT_EQ(1u, freeChunks.getNumChunks());
+    EXPECT_EQ(0x3000u, freeChunks.getFreeSize());
+
+    freeChunks.store(0x20000u, 0u);
+    EXPECT_EQ(1u, freeChunks.getNumChunks());
+
+    auto chunk = freeChunks.takeStartingAt(0x10000u);
+    EXPECT_EQ(0x10000u, chunk.ptr);
+    EXPECT_EQ(0x3000u, chunk.size);
+    EXPECT_EQ(0u, freeChunks.getNumChunks());
+    EXPECT_EQ(0u, freeChunks.getFreeSize());
+}
+
+TEST(SegregatedFreeChunksTest, givenChunksOfDifferentSizesWhenTakingChunkThenSmallestSizeClassThatFitsIsUsed) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.store(0x100000u, 0x1000u);
+    freeChunks.store(0x200000u, 0x8000u);
+    freeChunks.store(0x300000u, 0x40000u);
+
+    auto chunk = freeChunks.take(0x2000u);
+    EXPECT_EQ(0x200000u, chunk.ptr);
+    EXPECT_EQ(0x8000u, chunk.size);
+
+    chunk = freeChunks.take(0x1000u);
+    EXPECT_EQ(0x100000u, chunk.ptr);
+
+    chunk = freeChunks.take(0x80000u);
+    EXPECT_EQ(0u, chunk.ptr);
+    EXPECT_EQ(0u, chunk.size);
+    EXPECT_EQ(1u, freeChunks.getNumChunks());
+}
+
+TEST(SegregatedFreeChunksTest, givenOnlyChunkFittingIsInRequestedSizeClassWhenTakingChunkThenItIsFound) {
+    SegregatedFreeChunks freeChunks;
+    const size_t requestedSize = 33 * MemoryConstants::pageSize;
+    freeChunks.store(0x400000u, requestedSize);
+    freeChunks.store(0x100000u, 32 * MemoryConstants::pageSize);
+
+    auto chunk = freeChunks.take(requestedSize);
+    EXPECT_EQ(0x400000u, chunk.ptr);
+    EXPECT_EQ(requestedSize, chunk.size);
+
+    chunk = freeChunks.take(requestedSize);
+    EXPECT_EQ(0u, chunk.size);
+}
+
+TEST(SegregatedFreeChunksTest, givenStoredChunkWhenTakingByBoundaryThenOnlyMatchingBoundaryReturnsChunk) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.store(0x10000u, 0x3000u);
+
+    EXPECT_EQ(0u, freeChunks.takeStartingAt(0x11000u).size);
+    EXPECT_EQ(0u, freeChunks.takeEndingAt(0x12000u).size);
+
+    auto chunk = freeChunks.takeEndingAt(0x13000u);
+    EXPECT_EQ(0x10000u, chunk.ptr);
+    EXPECT_EQ(0x3000u, chunk.size);
+    EXPECT_EQ(0u, freeChunks.getNumChunks());
+}
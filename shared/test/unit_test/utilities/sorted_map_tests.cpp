@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024-2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/sorted_map.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+struct Data {
+    size_t size;
+};
+} // namespace
+using TestedSortedMap = NEO::BaseSortedPointerWithValueMap<Data>;
+
+TEST(SortedMapTest, givenBaseSortedMapWhenGettingNullptrThenNullptrIsReturned) {
+    TestedSortedMap testedMap;
+    EXPECT_EQ(nullptr, testedMap.get(nullptr));
+
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100u});
+    EXPECT_EQ(nullptr, testedMap.get(nullptr));
+}
+
+TEST(SortedMapTest, givenRangesInsertedInAnyOrderWhenGettingThenRangeContainingPointerIsReturned) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x3000), Data{0x100u});
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100u});
+    testedMap.insert(reinterpret_cast<void *>(0x2000), Data{0x1000u});
+    EXPECT_EQ(3u, testedMap.getNumAllocs());
+
+    const void *expectedOrder[] = {reinterpret_cast<void *>(0x1000), reinterpret_cast<void *>(0x2000), reinterpret_cast<void *>(0x3000)};
+    size_t i = 0;
+    for (auto &allocation : testedMap.allocations) {
+        EXPECT_EQ(expectedOrder[i++], allocation.first);
+    }
+
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0xfff)));
+    EXPECT_EQ(testedMap.allocations.begin()->second.get(), testedMap.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(testedMap.allocations.begin()->second.get(), testedMap.get(reinterpret_cast<void *>(0x10ff)));
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x1100)));
+    EXPECT_EQ(0x1000u, testedMap.get(reinterpret_cast<void *>(0x2fff))->size);
+    EXPECT_EQ(0x100u, testedMap.get(reinterpret_cast<void *>(0x3000))->size);
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x3100)));
+
+    EXPECT_EQ(testedMap.allocations.end(), testedMap.getImpl(reinterpret_cast<void *>(0x1001), false));
+    EXPECT_NE(testedMap.allocations.end(), testedMap.getImpl(reinterpret_cast<void *>(0x1000), false));
+}
+
+TEST(SortedMapTest, givenPointerAlreadyInsertedWhenInsertingAgainThenAbortIsCalledAndValueIsNotReplaced) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100u});
+
+    EXPECT_THROW(testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x200u}), std::exception);
+    EXPECT_EQ(1u, testedMap.getNumAllocs());
+    EXPECT_EQ(0x100u, testedMap.get(reinterpret_cast<void *>(0x1000))->size);
+}
+
+TEST(SortedMapTest, givenZeroSizeRangeWhenGettingThenOnlyExactPointerMatches) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0u});
+    EXPECT_NE(nullptr, testedMap.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x1001)));
+}
+
+TEST(SortedMapTest, givenBaseSortedMapWhenRemovingOrExtractingThenRemovalEpochIsIncremented) {
+    TestedSortedMap testedMap;
+    void *ptr = reinterpret_cast<void *>(0x1);
+    testedMap.insert(ptr, Data{1u});
+    testedMap.insert(reinterpret_cast<void *>(0x2), Data{2u});
+    auto epoch = testedMap.getRemovalEpoch();
+
+    EXPECT_EQ(nullptr, testedMap.extract(nullptr));
+    EXPECT_EQ(epoch, testedMap.getRemovalEpoch());
+
+    auto valuePtr = testedMap.extract(ptr);
+    ASSERT_NE(nullptr, valuePtr);
+    EXPECT_EQ(1u, valuePtr->size);
+    EXPECT_EQ(nullptr, testedMap.extract(ptr));
+    EXPECT_LT(epoch, testedMap.getRemovalEpoch());
+
+    epoch = testedMap.getRemovalEpoch();
+    testedMap.remove(reinterpret_cast<void *>(0x2));
+    EXPECT_LT(epoch, testedMap.getRemovalEpoch());
+    EXPECT_EQ(0u, testedMap.getNumAllocs());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,10 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cstdint>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -83,12 +86,15 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::getThreadCache;
     using BaseClass::gfxAllocations;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
+    using BaseClass::threadCacheBatchSize;
+    using BaseClass::threadCaches;
     using BaseClass::usedTags;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
@@ -124,6 +130,22 @@ class MockTagAllocator : public TagAllocator<TagType> {
     size_t getTagPoolCount() {
         return this->tagPoolMemory.size();
     }
+
+    size_t getFreeTagsCount() {
+        size_t count = 0;
+        for (auto node = this->freeTags.peekHead(); node != nullptr; node = node->next) {
+            count++;
+        }
+        return count;
+    }
+
+    size_t getThreadCachedTagsCount() {
+        size_t count = 0;
+        for (auto &threadCache : threadCaches) {
+            count += threadCache.second->numTags;
+        }
+        return count;
+    }
 };
 
 TEST_F(TagAllocatorTest, givenTagNodeTypeWhenCopyingOrMovingThenDisallow) {
@@ -641,3 +663,135 @@ TEST_F(TagAllocatorTest, givenNotSupportedTagTypeWhenCallingMethodThenAbortOrRet
         EXPECT_NO_THROW(timestampPacketsNode.getGlobalStartValue(0));
     }
 }
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenGettingAndReturningTagThenBatchIsMovedToThreadCacheAndUsedListIsNotUpdated) {
+    debugManager.flags.TagAllocatorThreadCacheBatchSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    EXPECT_EQ(4u, tagAllocator.threadCacheBatchSize);
+
+    auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    ASSERT_NE(nullptr, tagNode);
+    EXPECT_EQ(1u, tagNode->tagForCpuAccess->initializeCount);
+
+    auto &threadCache = tagAllocator.getThreadCache();
+    EXPECT_EQ(3u, threadCache.numTags);
+    EXPECT_EQ(6u, tagAllocator.getFreeTagsCount());
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+    EXPECT_FALSE(threadCache.tags.peekContains(*tagNode));
+
+    tagNode->incRefCount();
+    tagAllocator.returnTag(tagNode);
+    EXPECT_EQ(3u, threadCache.numTags);
+
+    tagAllocator.returnTag(tagNode);
+    EXPECT_EQ(4u, threadCache.numTags);
+    EXPECT_TRUE(threadCache.tags.peekContains(*tagNode));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tagNode));
+
+    EXPECT_EQ(tagNode, tagAllocator.getTag());
+    tagAllocator.returnTag(tagNode);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheHoldingTwoBatchesWhenReturningTagThenBatchIsReleasedToSharedPool) {
+    debugManager.flags.TagAllocatorThreadCacheBatchSize.set(2);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    auto &threadCache = tagAllocator.getThreadCache();
+
+    TagNodeBase *tagNodes[6] = {};
+    for (auto &tagNode : tagNodes) {
+        tagNode = tagAllocator.getTag();
+    }
+    EXPECT_EQ(0u, threadCache.numTags);
+    EXPECT_EQ(4u, tagAllocator.getFreeTagsCount());
+
+    for (size_t i = 0; i < 4; i++) {
+        tagAllocator.returnTag(tagNodes[i]);
+    }
+    EXPECT_EQ(4u, threadCache.numTags);
+    EXPECT_EQ(4u, tagAllocator.getFreeTagsCount());
+
+    tagAllocator.returnTag(tagNodes[4]);
+    EXPECT_EQ(3u, threadCache.numTags);
+    EXPECT_EQ(6u, tagAllocator.getFreeTagsCount());
+
+    tagAllocator.returnTag(tagNodes[5]);
+    EXPECT_EQ(4u, threadCache.numTags);
+    EXPECT_EQ(6u, tagAllocator.getFreeTagsCount());
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenAllNodesWereUsedThenCreateNewGraphicsAllocation) {
+    debugManager.flags.TagAllocatorThreadCacheBatchSize.set(3);
+
+    // Big alignment to force only 4 tags
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1024, deviceBitfield);
+
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_NE(nullptr, tagAllocator.getTag());
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+
+    EXPECT_NE(nullptr, tagAllocator.getTag());
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(1u, tagAllocator.getFreeTagsCount());
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheOfExitedThreadWhenSharedPoolIsEmptyThenTagsAreReclaimedInsteadOfCreatingNewGraphicsAllocation) {
+    debugManager.flags.TagAllocatorThreadCacheBatchSize.set(2);
+
+    // Big alignment to force only 4 tags
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1024, deviceBitfield);
+
+    std::thread([&tagAllocator]() {
+        tagAllocator.returnTag(tagAllocator.getTag());
+        EXPECT_EQ(2u, tagAllocator.getThreadCache().numTags);
+    }).join();
+    EXPECT_EQ(1u, tagAllocator.threadCaches.size());
+    EXPECT_EQ(2u, tagAllocator.getFreeTagsCount());
+
+    TagNodeBase *tagNodes[4] = {};
+    for (auto &tagNode : tagNodes) {
+        tagNode = tagAllocator.getTag();
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(1u, tagAllocator.threadCaches.size());
+    EXPECT_EQ(0u, tagAllocator.getThreadCachedTagsCount());
+
+    for (auto &tagNode : tagNodes) {
+        tagAllocator.returnTag(tagNode);
+    }
+    EXPECT_EQ(4u, tagAllocator.getThreadCachedTagsCount());
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagsAreUsedConcurrentlyThenEachTagIsHeldByOneThreadAtATime) {
+    debugManager.flags.TagAllocatorThreadCacheBatchSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 64, 16, deviceBitfield);
+
+    constexpr uint64_t numThreads = 4;
+    std::atomic<uint32_t> errors{0u};
+    std::vector<std::thread> threads;
+    for (uint64_t threadId = 1; threadId <= numThreads; threadId++) {
+        threads.emplace_back([&tagAllocator, &errors, threadId]() {
+            for (uint32_t i = 0; i < 1000; i++) {
+                TagNode<TimeStamps> *tagNodes[4] = {};
+                for (auto &tagNode : tagNodes) {
+                    tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+                    tagNode->tagForCpuAccess->start = threadId;
+                }
+                std::this_thread::yield();
+                for (auto &tagNode : tagNodes) {
+                    if (tagNode->tagForCpuAccess->start != threadId) {
+                        errors++;
+                    }
+                    tagAllocator.returnTag(tagNode);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, errors.load());
+    EXPECT_EQ(tagAllocator.getTagPoolCount() * 64, tagAllocator.getFreeTagsCount() + tagAllocator.getThreadCachedTagsCount());
+}
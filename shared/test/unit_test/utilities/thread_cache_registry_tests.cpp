@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_cache_registry.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ThreadCacheRegistryTest, givenOwnersWhenRegisteredThenIdsAreUnique) {
+    auto firstOwnerId = ThreadCacheRegistry::registerOwner();
+    auto secondOwnerId = ThreadCacheRegistry::registerOwner();
+    EXPECT_NE(0u, firstOwnerId);
+    EXPECT_NE(firstOwnerId, secondOwnerId);
+
+    ThreadCacheRegistry::unregisterOwner(firstOwnerId);
+    ThreadCacheRegistry::unregisterOwner(secondOwnerId);
+}
+
+TEST(ThreadCacheRegistryTest, givenManyOwnersWithThreadCachesWhenGettingThreadCacheThenCacheOfEachOwnerIsReturned) {
+    constexpr size_t numOwners = 64u;
+    std::vector<uint64_t> ownerIds;
+    std::vector<int> caches(numOwners);
+    for (size_t i = 0; i < numOwners; i++) {
+        ownerIds.push_back(ThreadCacheRegistry::registerOwner());
+        EXPECT_EQ(nullptr, ThreadCacheRegistry::getThreadCache(ownerIds[i]));
+        ThreadCacheRegistry::setThreadCache(ownerIds[i], &caches[i]);
+    }
+
+    for (size_t i = 0; i < numOwners; i++) {
+        EXPECT_EQ(&caches[i], ThreadCacheRegistry::getThreadCache(ownerIds[i]));
+    }
+
+    for (auto ownerId : ownerIds) {
+        ThreadCacheRegistry::unregisterOwner(ownerId);
+    }
+}
+
+TEST(ThreadCacheRegistryTest, givenUnregisteredOwnerWhenGettingThreadCacheThenNullIsReturnedAndOtherOwnersAreNotAffected) {
+    int cache = 0;
+    int otherCache = 0;
+    auto ownerId = ThreadCacheRegistry::registerOwner();
+    auto otherOwnerId = ThreadCacheRegistry::registerOwner();
+    ThreadCacheRegistry::setThreadCache(ownerId, &cache);
+    ThreadCacheRegistry::setThreadCache(otherOwnerId, &otherCache);
+
+    ThreadCacheRegistry::unregisterOwner(ownerId);
+
+    EXPECT_EQ(nullptr, ThreadCacheRegistry::getThreadCache(ownerId));
+    EXPECT_EQ(&otherCache, ThreadCacheRegistry::getThreadCache(otherOwnerId));
+
+    ThreadCacheRegistry::unregisterOwner(otherOwnerId);
+}
+
+TEST(ThreadCacheRegistryTest, givenOtherThreadWhenGettingThreadCacheThenCacheSetByCurrentThreadIsNotVisible) {
+    int cache = 0;
+    auto ownerId = ThreadCacheRegistry::registerOwner();
+    ThreadCacheRegistry::setThreadCache(ownerId, &cache);
+
+    void *otherThreadCache = &cache;
+    uint64_t otherThreadToken = 0u;
+    std::shared_ptr<std::atomic<bool>> otherThreadAlive;
+    std::thread([&]() {
+        otherThreadCache = ThreadCacheRegistry::getThreadCache(ownerId);
+        otherThreadToken = ThreadCacheRegistry::getThreadToken();
+        otherThreadAlive = ThreadCacheRegistry::getThreadAliveFlag();
+        EXPECT_TRUE(otherThreadAlive->load());
+    }).join();
+
+    EXPECT_EQ(nullptr, otherThreadCache);
+    EXPECT_NE(ThreadCacheRegistry::getThreadToken(), otherThreadToken);
+    EXPECT_FALSE(otherThreadAlive->load());
+    EXPECT_TRUE(ThreadCacheRegistry::getThreadAliveFlag()->load());
+    EXPECT_EQ(&cache, ThreadCacheRegistry::getThreadCache(ownerId));
+
+    ThreadCacheRegistry::unregisterOwner(ownerId);
+}